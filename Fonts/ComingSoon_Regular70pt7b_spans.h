@@ -0,0 +1,280 @@
+// ComingSoon_Regular70pt7b span encoded by tools/gfxfont_to_spanfont.py from Fonts/ComingSoon_Regular70pt7b.h
+// characters: 0123456789:
+// 4111 span bytes, 8791 bytes as GFXfont bitmap
+
+const uint8_t ComingSoon_Regular70pt7bSpanData[] PROGMEM = {
+  0x01, 0x16, 0x10, 0x01, 0x13, 0x15, 0x01, 0x12, 0x18, 0x01, 0x11, 0x1A, 0x01, 0x10, 0x1D, 0x01,
+  0x0F, 0x1F, 0x01, 0x0E, 0x21, 0x01, 0x0D, 0x23, 0x03, 0x0C, 0x0B, 0x01, 0x0A, 0x03, 0x0C, 0x03,
+  0x0C, 0x09, 0x08, 0x04, 0x06, 0x0B, 0x02, 0x0B, 0x09, 0x14, 0x0B, 0x02, 0x0B, 0x09, 0x15, 0x0B,
+  0x02, 0x0A, 0x09, 0x18, 0x0A, 0x02, 0x0A, 0x08, 0x1A, 0x09, 0x02, 0x09, 0x09, 0x1A, 0x0A, 0x02,
+  0x09, 0x08, 0x1C, 0x0A, 0x02, 0x08, 0x08, 0x1E, 0x09, 0x02, 0x08, 0x08, 0x1F, 0x09, 0x02, 0x07,
+  0x08, 0x21, 0x09, 0x02, 0x07, 0x08, 0x21, 0x09, 0x02, 0x07, 0x08, 0x22, 0x09, 0x02, 0x06, 0x08,
+  0x24, 0x08, 0x02, 0x06, 0x08, 0x24, 0x09, 0x02, 0x06, 0x07, 0x26, 0x09, 0x02, 0x05, 0x08, 0x27,
+  0x08, 0x02, 0x05, 0x08, 0x27, 0x09, 0x02, 0x05, 0x07, 0x29, 0x08, 0x02, 0x04, 0x08, 0x29, 0x09,
+  0x02, 0x04, 0x08, 0x2A, 0x08, 0x02, 0x04, 0x08, 0x2A, 0x08, 0x02, 0x04, 0x07, 0x2C, 0x08, 0x02,
+  0x03, 0x08, 0x2C, 0x08, 0x02, 0x03, 0x08, 0x2C, 0x09, 0x02, 0x03, 0x08, 0x2D, 0x08, 0x02, 0x03,
+  0x07, 0x2E, 0x08, 0x02, 0x02, 0x08, 0x2F, 0x08, 0x02, 0x02, 0x08, 0x2F, 0x08, 0x02, 0x02, 0x08,
+  0x2F, 0x08, 0x02, 0x02, 0x08, 0x30, 0x07, 0x02, 0x02, 0x07, 0x31, 0x08, 0x02, 0x02, 0x07, 0x31,
+  0x08, 0x02, 0x01, 0x08, 0x31, 0x08, 0x02, 0x01, 0x08, 0x32, 0x07, 0x02, 0x01, 0x08, 0x32, 0x07,
+  0x02, 0x01, 0x08, 0x32, 0x08, 0x02, 0x01, 0x08, 0x32, 0x08, 0x02, 0x01, 0x07, 0x33, 0x08, 0x02,
+  0x01, 0x07, 0x34, 0x07, 0x02, 0x01, 0x07, 0x34, 0x07, 0x02, 0x01, 0x07, 0x34, 0x07, 0x02, 0x01,
+  0x07, 0x34, 0x07, 0x02, 0x01, 0x07, 0x34, 0x07, 0x02, 0x01, 0x07, 0x34, 0x08, 0x02, 0x00, 0x08,
+  0x34, 0x08, 0x02, 0x00, 0x08, 0x34, 0x08, 0x02, 0x00, 0x08, 0x34, 0x08, 0x02, 0x00, 0x08, 0x34,
+  0x08, 0x02, 0x00, 0x08, 0x34, 0x08, 0x02, 0x01, 0x07, 0x34, 0x08, 0x02, 0x01, 0x07, 0x34, 0x08,
+  0x02, 0x01, 0x07, 0x34, 0x07, 0x02, 0x01, 0x07, 0x34, 0x07, 0x02, 0x01, 0x07, 0x34, 0x07, 0x02,
+  0x01, 0x07, 0x34, 0x07, 0x02, 0x01, 0x07, 0x33, 0x08, 0x02, 0x01, 0x08, 0x32, 0x08, 0x02, 0x01,
+  0x08, 0x32, 0x08, 0x02, 0x01, 0x08, 0x32, 0x08, 0x02, 0x01, 0x08, 0x32, 0x07, 0x02, 0x02, 0x07,
+  0x31, 0x08, 0x02, 0x02, 0x08, 0x30, 0x08, 0x02, 0x02, 0x08, 0x30, 0x08, 0x02, 0x02, 0x08, 0x30,
+  0x07, 0x02, 0x03, 0x07, 0x2F, 0x08, 0x02, 0x03, 0x08, 0x2E, 0x08, 0x02, 0x03, 0x08, 0x2D, 0x08,
+  0x02, 0x04, 0x07, 0x2D, 0x08, 0x02, 0x04, 0x08, 0x2C, 0x08, 0x02, 0x04, 0x08, 0x2B, 0x08, 0x02,
+  0x05, 0x08, 0x2A, 0x08, 0x02, 0x05, 0x09, 0x28, 0x09, 0x02, 0x06, 0x08, 0x28, 0x08, 0x02, 0x06,
+  0x09, 0x26, 0x09, 0x02, 0x07, 0x09, 0x24, 0x09, 0x02, 0x07, 0x09, 0x24, 0x09, 0x02, 0x08, 0x09,
+  0x22, 0x09, 0x02, 0x08, 0x0A, 0x20, 0x09, 0x02, 0x09, 0x0A, 0x1F, 0x09, 0x02, 0x0A, 0x0A, 0x1D,
+  0x09, 0x02, 0x0B, 0x0B, 0x1A, 0x09, 0x02, 0x0C, 0x0B, 0x18, 0x0A, 0x02, 0x0C, 0x0D, 0x15, 0x0A,
+  0x02, 0x0D, 0x0E, 0x11, 0x0B, 0x02, 0x0F, 0x0F, 0x0D, 0x0B, 0x02, 0x10, 0x14, 0x03, 0x0E, 0x01,
+  0x11, 0x23, 0x01, 0x12, 0x21, 0x01, 0x14, 0x1E, 0x01, 0x16, 0x1B, 0x01, 0x18, 0x17, 0x01, 0x1B,
+  0x12, 0x01, 0x1F, 0x0C, 0x01, 0x12, 0x04, 0x01, 0x11, 0x08, 0x01, 0x0F, 0x0A, 0x01, 0x0E, 0x0C,
+  0x01, 0x0C, 0x0E, 0x01, 0x0B, 0x0F, 0x01, 0x0A, 0x10, 0x01, 0x08, 0x13, 0x01, 0x07, 0x14, 0x02,
+  0x05, 0x0D, 0x01, 0x08, 0x02, 0x04, 0x0D, 0x02, 0x08, 0x02, 0x03, 0x0C, 0x05, 0x07, 0x02, 0x02,
+  0x0C, 0x06, 0x07, 0x02, 0x00, 0x0D, 0x07, 0x07, 0x02, 0x00, 0x0B, 0x09, 0x07, 0x02, 0x00, 0x0A,
+  0x0A, 0x08, 0x02, 0x00, 0x08, 0x0C, 0x08, 0x02, 0x00, 0x07, 0x0D, 0x08, 0x02, 0x01, 0x05, 0x0E,
+  0x08, 0x02, 0x03, 0x01, 0x10, 0x08, 0x01, 0x15, 0x07, 0x01, 0x15, 0x07, 0x01, 0x15, 0x07, 0x01,
+  0x15, 0x07, 0x01, 0x15, 0x07, 0x01, 0x15, 0x07, 0x01, 0x15, 0x08, 0x01, 0x15, 0x08, 0x01, 0x15,
+  0x08, 0x01, 0x15, 0x08, 0x01, 0x15, 0x08, 0x01, 0x15, 0x08, 0x01, 0x15, 0x08, 0x01, 0x16, 0x07,
+  0x01, 0x16, 0x07, 0x01, 0x16, 0x07, 0x01, 0x16, 0x07, 0x01, 0x16, 0x07, 0x01, 0x16, 0x07, 0x01,
+  0x16, 0x07, 0x01, 0x16, 0x07, 0x01, 0x16, 0x07, 0x01, 0x16, 0x08, 0x01, 0x16, 0x08, 0x01, 0x16,
+  0x08, 0x01, 0x16, 0x08, 0x01, 0x16, 0x08, 0x01, 0x16, 0x08, 0x01, 0x16, 0x08, 0x01, 0x16, 0x08,
+  0x01, 0x16, 0x08, 0x01, 0x16, 0x08, 0x01, 0x16, 0x08, 0x01, 0x16, 0x08, 0x01, 0x16, 0x08, 0x01,
+  0x16, 0x08, 0x01, 0x17, 0x07, 0x01, 0x17, 0x07, 0x01, 0x17, 0x07, 0x01, 0x17, 0x07, 0x01, 0x17,
+  0x07, 0x01, 0x17, 0x07, 0x01, 0x17, 0x07, 0x01, 0x17, 0x08, 0x01, 0x17, 0x08, 0x01, 0x17, 0x08,
+  0x01, 0x17, 0x08, 0x01, 0x17, 0x08, 0x01, 0x17, 0x08, 0x01, 0x18, 0x07, 0x01, 0x18, 0x07, 0x01,
+  0x18, 0x07, 0x01, 0x18, 0x07, 0x01, 0x18, 0x07, 0x01, 0x18, 0x08, 0x01, 0x18, 0x08, 0x01, 0x18,
+  0x08, 0x01, 0x18, 0x08, 0x01, 0x18, 0x08, 0x01, 0x18, 0x08, 0x01, 0x19, 0x07, 0x01, 0x19, 0x07,
+  0x01, 0x19, 0x07, 0x01, 0x19, 0x07, 0x01, 0x19, 0x07, 0x01, 0x19, 0x08, 0x01, 0x19, 0x08, 0x01,
+  0x19, 0x08, 0x01, 0x19, 0x08, 0x01, 0x19, 0x08, 0x01, 0x1A, 0x07, 0x01, 0x1A, 0x07, 0x01, 0x1A,
+  0x07, 0x01, 0x1A, 0x07, 0x01, 0x1A, 0x08, 0x01, 0x1A, 0x08, 0x01, 0x1A, 0x08, 0x01, 0x1A, 0x08,
+  0x01, 0x1A, 0x08, 0x01, 0x1A, 0x08, 0x01, 0x1B, 0x07, 0x01, 0x1B, 0x07, 0x01, 0x1B, 0x07, 0x01,
+  0x1C, 0x05, 0x01, 0x1B, 0x0C, 0x01, 0x17, 0x14, 0x01, 0x14, 0x1A, 0x01, 0x10, 0x20, 0x01, 0x0E,
+  0x24, 0x01, 0x0C, 0x28, 0x01, 0x0B, 0x2B, 0x02, 0x09, 0x15, 0x05, 0x14, 0x02, 0x08, 0x11, 0x0F,
+  0x10, 0x02, 0x07, 0x0F, 0x15, 0x0E, 0x02, 0x06, 0x0D, 0x1A, 0x0D, 0x02, 0x05, 0x0C, 0x1E, 0x0C,
+  0x02, 0x05, 0x0A, 0x22, 0x0B, 0x02, 0x04, 0x0A, 0x24, 0x0A, 0x02, 0x03, 0x0A, 0x27, 0x09, 0x02,
+  0x03, 0x09, 0x29, 0x09, 0x02, 0x02, 0x09, 0x2A, 0x09, 0x02, 0x02, 0x08, 0x2C, 0x08, 0x02, 0x01,
+  0x09, 0x2D, 0x08, 0x02, 0x01, 0x08, 0x2E, 0x08, 0x02, 0x00, 0x09, 0x2F, 0x07, 0x02, 0x00, 0x08,
+  0x30, 0x08, 0x02, 0x00, 0x08, 0x30, 0x08, 0x02, 0x00, 0x07, 0x31, 0x08, 0x02, 0x00, 0x07, 0x32,
+  0x07, 0x02, 0x01, 0x05, 0x33, 0x07, 0x01, 0x39, 0x07, 0x01, 0x39, 0x07, 0x01, 0x39, 0x08, 0x01,
+  0x39, 0x08, 0x01, 0x39, 0x08, 0x01, 0x39, 0x08, 0x01, 0x39, 0x08, 0x01, 0x39, 0x08, 0x01, 0x39,
+  0x08, 0x01, 0x39, 0x08, 0x01, 0x39, 0x07, 0x01, 0x38, 0x08, 0x01, 0x38, 0x08, 0x01, 0x38, 0x08,
+  0x01, 0x37, 0x08, 0x01, 0x36, 0x09, 0x01, 0x36, 0x09, 0x01, 0x35, 0x09, 0x01, 0x34, 0x09, 0x01,
+  0x33, 0x0A, 0x01, 0x32, 0x0A, 0x01, 0x31, 0x0A, 0x01, 0x30, 0x0B, 0x01, 0x2E, 0x0C, 0x01, 0x2D,
+  0x0C, 0x01, 0x2C, 0x0C, 0x01, 0x2A, 0x0C, 0x01, 0x29, 0x0C, 0x01, 0x27, 0x0D, 0x01, 0x25, 0x0E,
+  0x01, 0x24, 0x0D, 0x01, 0x22, 0x0E, 0x01, 0x21, 0x0D, 0x01, 0x1F, 0x0E, 0x01, 0x1E, 0x0D, 0x01,
+  0x1C, 0x0E, 0x01, 0x1B, 0x0D, 0x01, 0x19, 0x0E, 0x01, 0x18, 0x0D, 0x01, 0x17, 0x0D, 0x01, 0x15,
+  0x0D, 0x01, 0x14, 0x0D, 0x01, 0x13, 0x0C, 0x01, 0x12, 0x0C, 0x01, 0x11, 0x0B, 0x01, 0x10, 0x0B,
+  0x01, 0x0F, 0x0B, 0x01, 0x0E, 0x0B, 0x01, 0x0E, 0x0A, 0x01, 0x0D, 0x0A, 0x01, 0x0C, 0x0A, 0x01,
+  0x0C, 0x09, 0x01, 0x0B, 0x09, 0x01, 0x0A, 0x09, 0x01, 0x0A, 0x09, 0x01, 0x09, 0x09, 0x01, 0x09,
+  0x08, 0x01, 0x09, 0x08, 0x01, 0x08, 0x08, 0x01, 0x08, 0x08, 0x01, 0x08, 0x07, 0x01, 0x07, 0x08,
+  0x01, 0x07, 0x08, 0x01, 0x07, 0x07, 0x01, 0x06, 0x08, 0x01, 0x06, 0x08, 0x01, 0x06, 0x08, 0x01,
+  0x06, 0x08, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x02, 0x06, 0x07, 0x12, 0x14,
+  0x02, 0x05, 0x08, 0x06, 0x2A, 0x01, 0x05, 0x3F, 0x01, 0x05, 0x41, 0x01, 0x05, 0x41, 0x01, 0x05,
+  0x41, 0x01, 0x05, 0x42, 0x01, 0x06, 0x40, 0x02, 0x06, 0x13, 0x1F, 0x0E, 0x02, 0x08, 0x07, 0x31,
+  0x04, 0x02, 0x15, 0x20, 0x04, 0x03, 0x01, 0x0B, 0x32, 0x01, 0x04, 0x3A, 0x01, 0x02, 0x3D, 0x01,
+  0x01, 0x3F, 0x01, 0x01, 0x3F, 0x01, 0x01, 0x3F, 0x02, 0x02, 0x1B, 0x11, 0x11, 0x02, 0x02, 0x0D,
+  0x24, 0x0B, 0x02, 0x04, 0x02, 0x2C, 0x09, 0x01, 0x31, 0x0A, 0x01, 0x30, 0x0A, 0x01, 0x30, 0x09,
+  0x01, 0x2F, 0x09, 0x01, 0x2E, 0x0A, 0x01, 0x2D, 0x0A, 0x01, 0x2D, 0x09, 0x01, 0x2C, 0x09, 0x01,
+  0x2B, 0x0A, 0x01, 0x2A, 0x0A, 0x01, 0x29, 0x0A, 0x01, 0x29, 0x09, 0x01, 0x28, 0x09, 0x01, 0x27,
+  0x0A, 0x01, 0x26, 0x0A, 0x01, 0x25, 0x0A, 0x01, 0x25, 0x09, 0x01, 0x24, 0x09, 0x01, 0x23, 0x0A,
+  0x01, 0x22, 0x0A, 0x01, 0x21, 0x0A, 0x01, 0x21, 0x09, 0x01, 0x20, 0x09, 0x01, 0x1F, 0x0A, 0x01,
+  0x1E, 0x0A, 0x01, 0x1E, 0x0D, 0x01, 0x1D, 0x12, 0x01, 0x1D, 0x14, 0x01, 0x1D, 0x16, 0x01, 0x1D,
+  0x18, 0x01, 0x1E, 0x19, 0x01, 0x20, 0x18, 0x01, 0x28, 0x12, 0x01, 0x2C, 0x0F, 0x01, 0x2E, 0x0E,
+  0x01, 0x30, 0x0D, 0x01, 0x32, 0x0C, 0x01, 0x34, 0x0B, 0x01, 0x35, 0x0B, 0x01, 0x36, 0x0B, 0x01,
+  0x37, 0x0B, 0x01, 0x38, 0x0A, 0x01, 0x39, 0x0A, 0x01, 0x3A, 0x0A, 0x01, 0x3B, 0x09, 0x01, 0x3C,
+  0x09, 0x01, 0x3D, 0x08, 0x01, 0x3D, 0x09, 0x01, 0x3E, 0x08, 0x01, 0x3E, 0x09, 0x01, 0x3F, 0x08,
+  0x01, 0x3F, 0x09, 0x01, 0x40, 0x08, 0x01, 0x40, 0x08, 0x01, 0x41, 0x07, 0x01, 0x41, 0x08, 0x01,
+  0x41, 0x08, 0x01, 0x41, 0x08, 0x01, 0x42, 0x07, 0x01, 0x42, 0x07, 0x01, 0x42, 0x07, 0x01, 0x42,
+  0x07, 0x01, 0x42, 0x07, 0x01, 0x42, 0x07, 0x01, 0x41, 0x08, 0x01, 0x41, 0x08, 0x01, 0x41, 0x08,
+  0x02, 0x04, 0x01, 0x3C, 0x08, 0x02, 0x02, 0x05, 0x3A, 0x08, 0x02, 0x01, 0x06, 0x3A, 0x07, 0x02,
+  0x00, 0x08, 0x39, 0x07, 0x02, 0x00, 0x08, 0x38, 0x08, 0x02, 0x01, 0x08, 0x37, 0x08, 0x02, 0x01,
+  0x08, 0x37, 0x08, 0x02, 0x02, 0x08, 0x35, 0x08, 0x02, 0x02, 0x09, 0x34, 0x08, 0x02, 0x02, 0x0A,
+  0x32, 0x09, 0x02, 0x03, 0x0A, 0x30, 0x09, 0x02, 0x04, 0x0A, 0x2E, 0x0A, 0x02, 0x04, 0x0B, 0x2C,
+  0x0A, 0x02, 0x05, 0x0B, 0x2A, 0x0A, 0x02, 0x06, 0x0B, 0x27, 0x0C, 0x02, 0x07, 0x0D, 0x22, 0x0D,
+  0x02, 0x08, 0x0E, 0x1E, 0x0E, 0x02, 0x09, 0x11, 0x17, 0x10, 0x02, 0x0A, 0x14, 0x0F, 0x13, 0x01,
+  0x0B, 0x33, 0x01, 0x0D, 0x30, 0x01, 0x0E, 0x2D, 0x01, 0x11, 0x28, 0x01, 0x14, 0x22, 0x01, 0x18,
+  0x1C, 0x01, 0x1C, 0x14, 0x01, 0x21, 0x09, 0x01, 0x2F, 0x05, 0x01, 0x2E, 0x07, 0x01, 0x2E, 0x07,
+  0x01, 0x2E, 0x07, 0x01, 0x2E, 0x08, 0x01, 0x2E, 0x08, 0x01, 0x2E, 0x08, 0x01, 0x2E, 0x08, 0x01,
+  0x2F, 0x07, 0x01, 0x2F, 0x07, 0x01, 0x2F, 0x07, 0x02, 0x04, 0x01, 0x2A, 0x08, 0x02, 0x02, 0x05,
+  0x28, 0x08, 0x02, 0x01, 0x07, 0x27, 0x08, 0x02, 0x01, 0x07, 0x27, 0x08, 0x02, 0x00, 0x08, 0x27,
+  0x08, 0x02, 0x01, 0x07, 0x28, 0x07, 0x02, 0x01, 0x07, 0x28, 0x07, 0x02, 0x01, 0x08, 0x27, 0x07,
+  0x02, 0x01, 0x08, 0x27, 0x07, 0x02, 0x01, 0x08, 0x27, 0x07, 0x02, 0x01, 0x08, 0x27, 0x08, 0x02,
+  0x02, 0x07, 0x27, 0x08, 0x02, 0x02, 0x07, 0x27, 0x08, 0x02, 0x02, 0x07, 0x27, 0x08, 0x02, 0x02,
+  0x07, 0x27, 0x08, 0x02, 0x02, 0x07, 0x27, 0x08, 0x02, 0x02, 0x08, 0x27, 0x07, 0x02, 0x02, 0x08,
+  0x27, 0x07, 0x02, 0x02, 0x08, 0x27, 0x07, 0x02, 0x02, 0x08, 0x27, 0x07, 0x02, 0x02, 0x08, 0x27,
+  0x07, 0x02, 0x03, 0x07, 0x27, 0x07, 0x02, 0x03, 0x07, 0x27, 0x07, 0x02, 0x03, 0x07, 0x27, 0x07,
+  0x02, 0x03, 0x07, 0x27, 0x08, 0x02, 0x03, 0x07, 0x27, 0x08, 0x02, 0x03, 0x07, 0x27, 0x08, 0x02,
+  0x03, 0x07, 0x27, 0x08, 0x02, 0x03, 0x08, 0x26, 0x08, 0x02, 0x03, 0x08, 0x26, 0x08, 0x02, 0x03,
+  0x08, 0x26, 0x08, 0x02, 0x03, 0x08, 0x26, 0x08, 0x02, 0x03, 0x08, 0x26, 0x08, 0x02, 0x04, 0x07,
+  0x26, 0x08, 0x02, 0x04, 0x07, 0x27, 0x07, 0x02, 0x04, 0x07, 0x27, 0x07, 0x02, 0x04, 0x07, 0x27,
+  0x07, 0x02, 0x04, 0x07, 0x27, 0x07, 0x02, 0x04, 0x07, 0x27, 0x07, 0x02, 0x04, 0x07, 0x27, 0x07,
+  0x02, 0x04, 0x07, 0x27, 0x07, 0x02, 0x04, 0x07, 0x27, 0x07, 0x02, 0x04, 0x07, 0x27, 0x07, 0x04,
+  0x04, 0x07, 0x19, 0x05, 0x02, 0x01, 0x06, 0x07, 0x02, 0x04, 0x08, 0x09, 0x25, 0x01, 0x04, 0x3C,
+  0x01, 0x04, 0x3E, 0x01, 0x04, 0x3F, 0x01, 0x04, 0x3F, 0x01, 0x04, 0x3F, 0x01, 0x04, 0x3F, 0x02,
+  0x05, 0x16, 0x17, 0x10, 0x03, 0x05, 0x0B, 0x22, 0x08, 0x03, 0x04, 0x01, 0x32, 0x08, 0x01, 0x33,
+  0x07, 0x01, 0x33, 0x07, 0x01, 0x33, 0x07, 0x01, 0x33, 0x07, 0x01, 0x33, 0x07, 0x01, 0x33, 0x07,
+  0x01, 0x33, 0x08, 0x01, 0x33, 0x08, 0x01, 0x33, 0x08, 0x01, 0x33, 0x08, 0x01, 0x33, 0x08, 0x01,
+  0x34, 0x07, 0x01, 0x34, 0x07, 0x01, 0x34, 0x07, 0x01, 0x34, 0x07, 0x01, 0x34, 0x07, 0x01, 0x34,
+  0x07, 0x01, 0x34, 0x08, 0x01, 0x34, 0x08, 0x01, 0x34, 0x08, 0x01, 0x34, 0x08, 0x01, 0x35, 0x07,
+  0x01, 0x35, 0x07, 0x01, 0x35, 0x07, 0x01, 0x35, 0x07, 0x01, 0x35, 0x07, 0x01, 0x35, 0x08, 0x01,
+  0x35, 0x08, 0x01, 0x35, 0x08, 0x01, 0x35, 0x08, 0x01, 0x36, 0x07, 0x01, 0x36, 0x07, 0x01, 0x36,
+  0x07, 0x01, 0x36, 0x07, 0x01, 0x36, 0x07, 0x01, 0x36, 0x07, 0x01, 0x36, 0x07, 0x01, 0x37, 0x05,
+  0x02, 0x1B, 0x01, 0x01, 0x10, 0x01, 0x0F, 0x27, 0x01, 0x07, 0x35, 0x01, 0x03, 0x3A, 0x01, 0x02,
+  0x3B, 0x01, 0x02, 0x3C, 0x01, 0x01, 0x3D, 0x01, 0x01, 0x3C, 0x02, 0x00, 0x15, 0x1D, 0x0B, 0x02,
+  0x00, 0x0B, 0x2E, 0x01, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07,
+  0x01, 0x01, 0x07, 0x01, 0x01, 0x08, 0x01, 0x01, 0x08, 0x01, 0x01, 0x08, 0x01, 0x01, 0x08, 0x01,
+  0x01, 0x08, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02,
+  0x07, 0x01, 0x02, 0x08, 0x01, 0x02, 0x08, 0x01, 0x02, 0x08, 0x01, 0x02, 0x08, 0x01, 0x02, 0x08,
+  0x01, 0x02, 0x08, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x02, 0x03, 0x07, 0x17,
+  0x01, 0x02, 0x03, 0x07, 0x0B, 0x18, 0x02, 0x03, 0x07, 0x06, 0x21, 0x02, 0x03, 0x08, 0x02, 0x27,
+  0x01, 0x03, 0x33, 0x01, 0x03, 0x35, 0x01, 0x03, 0x37, 0x01, 0x03, 0x38, 0x02, 0x03, 0x16, 0x10,
+  0x13, 0x02, 0x03, 0x10, 0x1B, 0x0F, 0x02, 0x04, 0x0B, 0x23, 0x0C, 0x02, 0x05, 0x07, 0x28, 0x0B,
+  0x01, 0x35, 0x0B, 0x01, 0x37, 0x0A, 0x01, 0x38, 0x0A, 0x01, 0x39, 0x09, 0x01, 0x3A, 0x09, 0x01,
+  0x3B, 0x09, 0x01, 0x3B, 0x09, 0x01, 0x3C, 0x09, 0x01, 0x3D, 0x08, 0x01, 0x3D, 0x09, 0x01, 0x3E,
+  0x08, 0x01, 0x3E, 0x09, 0x01, 0x3F, 0x08, 0x01, 0x3F, 0x08, 0x01, 0x40, 0x07, 0x01, 0x40, 0x08,
+  0x01, 0x40, 0x08, 0x01, 0x40, 0x08, 0x01, 0x41, 0x07, 0x01, 0x41, 0x07, 0x01, 0x41, 0x08, 0x01,
+  0x41, 0x08, 0x01, 0x41, 0x08, 0x01, 0x41, 0x08, 0x01, 0x41, 0x08, 0x01, 0x41, 0x07, 0x01, 0x41,
+  0x07, 0x01, 0x41, 0x07, 0x01, 0x41, 0x07, 0x01, 0x40, 0x08, 0x02, 0x04, 0x03, 0x39, 0x08, 0x02,
+  0x02, 0x06, 0x38, 0x08, 0x02, 0x02, 0x07, 0x37, 0x08, 0x02, 0x02, 0x07, 0x37, 0x07, 0x02, 0x02,
+  0x08, 0x35, 0x08, 0x02, 0x02, 0x08, 0x35, 0x08, 0x02, 0x03, 0x08, 0x34, 0x08, 0x02, 0x03, 0x09,
+  0x32, 0x08, 0x02, 0x04, 0x08, 0x32, 0x08, 0x02, 0x04, 0x09, 0x30, 0x09, 0x02, 0x05, 0x09, 0x2E,
+  0x09, 0x02, 0x05, 0x0A, 0x2C, 0x0A, 0x02, 0x06, 0x0A, 0x2A, 0x0A, 0x02, 0x07, 0x0B, 0x27, 0x0A,
+  0x02, 0x08, 0x0B, 0x24, 0x0C, 0x02, 0x08, 0x0E, 0x1F, 0x0D, 0x02, 0x09, 0x10, 0x19, 0x0F, 0x02,
+  0x0A, 0x13, 0x12, 0x11, 0x02, 0x0C, 0x15, 0x09, 0x14, 0x01, 0x0D, 0x30, 0x01, 0x0E, 0x2E, 0x01,
+  0x10, 0x2A, 0x01, 0x13, 0x24, 0x01, 0x16, 0x1F, 0x01, 0x1A, 0x18, 0x01, 0x1E, 0x10, 0x01, 0x25,
+  0x09, 0x01, 0x1E, 0x15, 0x01, 0x1A, 0x1C, 0x01, 0x18, 0x21, 0x01, 0x16, 0x25, 0x01, 0x14, 0x28,
+  0x01, 0x12, 0x2C, 0x01, 0x11, 0x2E, 0x02, 0x0F, 0x12, 0x10, 0x0F, 0x02, 0x0E, 0x0F, 0x17, 0x0D,
+  0x02, 0x0D, 0x0E, 0x1B, 0x0C, 0x02, 0x0C, 0x0D, 0x1F, 0x0B, 0x02, 0x0B, 0x0C, 0x22, 0x0A, 0x02,
+  0x0A, 0x0B, 0x26, 0x09, 0x02, 0x09, 0x0B, 0x28, 0x09, 0x02, 0x09, 0x0A, 0x29, 0x09, 0x02, 0x08,
+  0x0A, 0x2B, 0x08, 0x02, 0x07, 0x0A, 0x2D, 0x07, 0x02, 0x07, 0x09, 0x2F, 0x05, 0x01, 0x06, 0x09,
+  0x01, 0x06, 0x08, 0x01, 0x05, 0x09, 0x01, 0x05, 0x08, 0x01, 0x05, 0x08, 0x01, 0x04, 0x08, 0x01,
+  0x04, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x02,
+  0x08, 0x01, 0x02, 0x08, 0x02, 0x02, 0x07, 0x1B, 0x0F, 0x02, 0x02, 0x07, 0x16, 0x19, 0x02, 0x01,
+  0x08, 0x13, 0x1F, 0x02, 0x01, 0x08, 0x10, 0x24, 0x02, 0x01, 0x08, 0x0E, 0x28, 0x02, 0x01, 0x07,
+  0x0D, 0x2C, 0x02, 0x01, 0x07, 0x0B, 0x2F, 0x03, 0x01, 0x07, 0x0A, 0x17, 0x06, 0x15, 0x03, 0x01,
+  0x07, 0x08, 0x12, 0x13, 0x10, 0x03, 0x00, 0x08, 0x07, 0x0F, 0x1A, 0x0E, 0x03, 0x00, 0x08, 0x06,
+  0x0D, 0x20, 0x0C, 0x03, 0x00, 0x08, 0x05, 0x0C, 0x23, 0x0C, 0x03, 0x00, 0x08, 0x04, 0x0B, 0x27,
+  0x0A, 0x03, 0x00, 0x08, 0x03, 0x0B, 0x29, 0x0A, 0x03, 0x00, 0x08, 0x02, 0x0A, 0x2C, 0x0A, 0x03,
+  0x00, 0x08, 0x02, 0x09, 0x2E, 0x09, 0x03, 0x00, 0x08, 0x01, 0x09, 0x30, 0x09, 0x02, 0x00, 0x11,
+  0x31, 0x0A, 0x02, 0x00, 0x10, 0x33, 0x09, 0x02, 0x00, 0x10, 0x34, 0x08, 0x02, 0x00, 0x0F, 0x35,
+  0x09, 0x02, 0x00, 0x0F, 0x36, 0x08, 0x02, 0x00, 0x0E, 0x37, 0x09, 0x02, 0x00, 0x0E, 0x38, 0x08,
+  0x02, 0x00, 0x0D, 0x39, 0x08, 0x02, 0x01, 0x0C, 0x39, 0x08, 0x02, 0x01, 0x0C, 0x3A, 0x07, 0x02,
+  0x01, 0x0C, 0x3A, 0x08, 0x02, 0x01, 0x0C, 0x3A, 0x08, 0x02, 0x01, 0x0B, 0x3B, 0x08, 0x02, 0x01,
+  0x0B, 0x3C, 0x07, 0x02, 0x01, 0x0A, 0x3D, 0x07, 0x02, 0x02, 0x08, 0x3E, 0x07, 0x02, 0x02, 0x08,
+  0x3E, 0x07, 0x02, 0x02, 0x08, 0x3E, 0x07, 0x02, 0x02, 0x08, 0x3E, 0x07, 0x02, 0x03, 0x07, 0x3E,
+  0x07, 0x02, 0x03, 0x08, 0x3D, 0x07, 0x02, 0x03, 0x08, 0x3D, 0x07, 0x02, 0x03, 0x08, 0x3C, 0x07,
+  0x02, 0x04, 0x08, 0x3B, 0x07, 0x02, 0x04, 0x08, 0x3B, 0x07, 0x02, 0x05, 0x08, 0x3A, 0x07, 0x02,
+  0x05, 0x08, 0x39, 0x08, 0x02, 0x05, 0x09, 0x38, 0x07, 0x02, 0x06, 0x08, 0x37, 0x08, 0x02, 0x06,
+  0x09, 0x36, 0x07, 0x02, 0x07, 0x08, 0x35, 0x08, 0x02, 0x07, 0x09, 0x33, 0x09, 0x02, 0x08, 0x09,
+  0x32, 0x08, 0x02, 0x09, 0x09, 0x30, 0x09, 0x02, 0x09, 0x0A, 0x2E, 0x09, 0x02, 0x0A, 0x0A, 0x2C,
+  0x09, 0x02, 0x0B, 0x0A, 0x2A, 0x0A, 0x02, 0x0B, 0x0B, 0x28, 0x0A, 0x02, 0x0C, 0x0C, 0x24, 0x0B,
+  0x02, 0x0D, 0x0C, 0x22, 0x0B, 0x02, 0x0E, 0x0D, 0x1E, 0x0C, 0x02, 0x0F, 0x0E, 0x1A, 0x0D, 0x02,
+  0x10, 0x10, 0x15, 0x0E, 0x02, 0x11, 0x13, 0x0D, 0x11, 0x01, 0x13, 0x2E, 0x01, 0x14, 0x2B, 0x01,
+  0x16, 0x28, 0x01, 0x18, 0x24, 0x01, 0x1A, 0x20, 0x01, 0x1D, 0x1A, 0x01, 0x21, 0x12, 0x01, 0x1C,
+  0x11, 0x01, 0x0E, 0x29, 0x01, 0x05, 0x37, 0x01, 0x01, 0x3C, 0x01, 0x00, 0x3E, 0x01, 0x00, 0x3E,
+  0x01, 0x00, 0x3E, 0x01, 0x00, 0x3E, 0x02, 0x00, 0x14, 0x1E, 0x0C, 0x02, 0x01, 0x08, 0x2D, 0x08,
+  0x01, 0x36, 0x07, 0x01, 0x35, 0x08, 0x01, 0x35, 0x08, 0x01, 0x35, 0x08, 0x01, 0x35, 0x08, 0x01,
+  0x34, 0x08, 0x01, 0x34, 0x08, 0x01, 0x34, 0x08, 0x01, 0x34, 0x07, 0x01, 0x33, 0x08, 0x01, 0x33,
+  0x08, 0x01, 0x33, 0x08, 0x01, 0x32, 0x08, 0x01, 0x32, 0x08, 0x01, 0x32, 0x08, 0x01, 0x32, 0x07,
+  0x01, 0x31, 0x08, 0x01, 0x31, 0x08, 0x01, 0x31, 0x08, 0x01, 0x30, 0x08, 0x01, 0x30, 0x08, 0x01,
+  0x30, 0x08, 0x01, 0x2F, 0x08, 0x01, 0x2F, 0x08, 0x01, 0x2F, 0x08, 0x01, 0x2F, 0x07, 0x01, 0x2E,
+  0x08, 0x01, 0x2E, 0x08, 0x01, 0x2E, 0x07, 0x01, 0x2D, 0x08, 0x01, 0x2D, 0x08, 0x01, 0x2D, 0x07,
+  0x01, 0x2C, 0x08, 0x01, 0x2C, 0x08, 0x01, 0x2C, 0x07, 0x01, 0x2B, 0x08, 0x01, 0x2B, 0x08, 0x01,
+  0x2A, 0x08, 0x01, 0x2A, 0x08, 0x01, 0x2A, 0x08, 0x01, 0x29, 0x08, 0x01, 0x29, 0x08, 0x01, 0x29,
+  0x08, 0x01, 0x28, 0x08, 0x01, 0x28, 0x08, 0x01, 0x28, 0x08, 0x01, 0x27, 0x08, 0x01, 0x27, 0x08,
+  0x01, 0x27, 0x08, 0x01, 0x26, 0x08, 0x01, 0x26, 0x08, 0x01, 0x26, 0x08, 0x01, 0x25, 0x08, 0x01,
+  0x25, 0x08, 0x01, 0x25, 0x08, 0x01, 0x25, 0x07, 0x01, 0x24, 0x08, 0x01, 0x24, 0x08, 0x01, 0x24,
+  0x07, 0x01, 0x23, 0x08, 0x01, 0x23, 0x08, 0x01, 0x23, 0x08, 0x01, 0x23, 0x07, 0x01, 0x22, 0x08,
+  0x01, 0x22, 0x08, 0x01, 0x22, 0x07, 0x01, 0x21, 0x08, 0x01, 0x21, 0x08, 0x01, 0x21, 0x08, 0x01,
+  0x21, 0x07, 0x01, 0x20, 0x08, 0x01, 0x20, 0x08, 0x01, 0x20, 0x07, 0x01, 0x1F, 0x08, 0x01, 0x1F,
+  0x08, 0x01, 0x1F, 0x08, 0x01, 0x1F, 0x07, 0x01, 0x1E, 0x08, 0x01, 0x1E, 0x08, 0x01, 0x1E, 0x07,
+  0x01, 0x1D, 0x08, 0x01, 0x1D, 0x08, 0x01, 0x1D, 0x08, 0x01, 0x1D, 0x07, 0x01, 0x1C, 0x08, 0x01,
+  0x1C, 0x08, 0x01, 0x1C, 0x07, 0x01, 0x1B, 0x08, 0x01, 0x1B, 0x08, 0x01, 0x1B, 0x08, 0x01, 0x1C,
+  0x06, 0x01, 0x1C, 0x06, 0x01, 0x1E, 0x02, 0x01, 0x1B, 0x12, 0x01, 0x17, 0x1A, 0x01, 0x14, 0x1F,
+  0x01, 0x12, 0x23, 0x01, 0x10, 0x27, 0x01, 0x0E, 0x2A, 0x01, 0x0D, 0x2C, 0x02, 0x0B, 0x13, 0x0C,
+  0x10, 0x02, 0x0A, 0x0F, 0x15, 0x0D, 0x02, 0x09, 0x0D, 0x1A, 0x0C, 0x02, 0x08, 0x0C, 0x1E, 0x0B,
+  0x02, 0x07, 0x0B, 0x21, 0x0B, 0x02, 0x06, 0x0B, 0x24, 0x09, 0x02, 0x06, 0x0A, 0x26, 0x09, 0x02,
+  0x05, 0x0A, 0x28, 0x09, 0x02, 0x05, 0x09, 0x29, 0x09, 0x02, 0x04, 0x09, 0x2B, 0x08, 0x02, 0x04,
+  0x08, 0x2D, 0x08, 0x02, 0x03, 0x09, 0x2D, 0x08, 0x02, 0x03, 0x08, 0x2F, 0x08, 0x02, 0x03, 0x08,
+  0x2F, 0x08, 0x02, 0x03, 0x08, 0x2F, 0x08, 0x02, 0x03, 0x07, 0x31, 0x07, 0x02, 0x03, 0x07, 0x31,
+  0x07, 0x02, 0x03, 0x07, 0x31, 0x07, 0x02, 0x03, 0x08, 0x30, 0x07, 0x02, 0x03, 0x08, 0x30, 0x07,
+  0x02, 0x03, 0x08, 0x30, 0x07, 0x02, 0x04, 0x08, 0x2E, 0x08, 0x02, 0x04, 0x08, 0x2E, 0x08, 0x02,
+  0x04, 0x08, 0x2E, 0x08, 0x02, 0x05, 0x08, 0x2D, 0x08, 0x02, 0x05, 0x08, 0x2D, 0x08, 0x02, 0x05,
+  0x09, 0x2B, 0x08, 0x02, 0x06, 0x09, 0x29, 0x09, 0x02, 0x06, 0x0A, 0x28, 0x08, 0x02, 0x07, 0x09,
+  0x26, 0x0A, 0x02, 0x08, 0x0A, 0x23, 0x0A, 0x02, 0x08, 0x0B, 0x20, 0x0C, 0x02, 0x09, 0x0C, 0x1C,
+  0x0D, 0x02, 0x0A, 0x0D, 0x17, 0x0F, 0x02, 0x0B, 0x11, 0x0F, 0x11, 0x01, 0x0C, 0x2F, 0x01, 0x0D,
+  0x2C, 0x01, 0x0E, 0x2A, 0x01, 0x10, 0x29, 0x01, 0x12, 0x29, 0x01, 0x11, 0x2C, 0x01, 0x0F, 0x2F,
+  0x01, 0x0D, 0x32, 0x02, 0x0C, 0x13, 0x11, 0x11, 0x02, 0x0A, 0x11, 0x19, 0x0E, 0x02, 0x09, 0x0F,
+  0x1E, 0x0D, 0x02, 0x08, 0x0D, 0x23, 0x0C, 0x02, 0x07, 0x0C, 0x27, 0x0A, 0x02, 0x06, 0x0C, 0x29,
+  0x0A, 0x02, 0x05, 0x0B, 0x2C, 0x0A, 0x02, 0x05, 0x0A, 0x2E, 0x0A, 0x02, 0x04, 0x0A, 0x30, 0x09,
+  0x02, 0x03, 0x0A, 0x32, 0x09, 0x02, 0x03, 0x09, 0x34, 0x08, 0x02, 0x02, 0x09, 0x35, 0x09, 0x02,
+  0x02, 0x08, 0x37, 0x08, 0x02, 0x01, 0x09, 0x38, 0x08, 0x02, 0x01, 0x08, 0x39, 0x08, 0x02, 0x01,
+  0x08, 0x39, 0x08, 0x02, 0x00, 0x08, 0x3B, 0x07, 0x02, 0x00, 0x08, 0x3B, 0x08, 0x02, 0x00, 0x08,
+  0x3B, 0x08, 0x02, 0x00, 0x08, 0x3B, 0x08, 0x02, 0x00, 0x08, 0x3C, 0x07, 0x02, 0x00, 0x08, 0x3C,
+  0x07, 0x02, 0x00, 0x08, 0x3C, 0x07, 0x02, 0x01, 0x07, 0x3C, 0x07, 0x02, 0x01, 0x08, 0x3B, 0x07,
+  0x02, 0x01, 0x08, 0x3A, 0x08, 0x02, 0x01, 0x08, 0x3A, 0x08, 0x02, 0x02, 0x08, 0x39, 0x08, 0x02,
+  0x02, 0x08, 0x39, 0x08, 0x02, 0x02, 0x08, 0x39, 0x08, 0x02, 0x03, 0x08, 0x38, 0x07, 0x02, 0x03,
+  0x09, 0x36, 0x08, 0x02, 0x04, 0x08, 0x36, 0x08, 0x02, 0x04, 0x09, 0x34, 0x09, 0x02, 0x05, 0x09,
+  0x32, 0x09, 0x02, 0x05, 0x0A, 0x30, 0x0A, 0x02, 0x06, 0x0A, 0x2E, 0x0A, 0x02, 0x06, 0x0B, 0x2C,
+  0x0B, 0x02, 0x07, 0x0B, 0x29, 0x0C, 0x02, 0x08, 0x0B, 0x26, 0x0D, 0x02, 0x09, 0x0C, 0x22, 0x0E,
+  0x02, 0x0A, 0x0E, 0x1C, 0x10, 0x02, 0x0B, 0x12, 0x13, 0x13, 0x02, 0x0C, 0x19, 0x06, 0x17, 0x01,
+  0x0D, 0x33, 0x01, 0x0F, 0x2F, 0x01, 0x10, 0x2C, 0x01, 0x12, 0x28, 0x01, 0x15, 0x22, 0x01, 0x19,
+  0x1A, 0x01, 0x20, 0x0F, 0x01, 0x1E, 0x0E, 0x01, 0x19, 0x18, 0x01, 0x16, 0x1E, 0x01, 0x14, 0x23,
+  0x01, 0x12, 0x27, 0x01, 0x10, 0x2B, 0x01, 0x0E, 0x2E, 0x02, 0x0D, 0x13, 0x09, 0x15, 0x02, 0x0C,
+  0x10, 0x12, 0x11, 0x02, 0x0B, 0x0E, 0x18, 0x0F, 0x02, 0x0A, 0x0D, 0x1C, 0x0E, 0x02, 0x09, 0x0C,
+  0x20, 0x0D, 0x02, 0x08, 0x0B, 0x24, 0x0C, 0x02, 0x07, 0x0B, 0x27, 0x0B, 0x02, 0x06, 0x0A, 0x2A,
+  0x0B, 0x02, 0x06, 0x09, 0x2C, 0x0B, 0x02, 0x05, 0x09, 0x2F, 0x09, 0x02, 0x04, 0x09, 0x31, 0x09,
+  0x02, 0x04, 0x08, 0x32, 0x0A, 0x02, 0x03, 0x09, 0x33, 0x09, 0x02, 0x03, 0x08, 0x35, 0x09, 0x02,
+  0x02, 0x08, 0x37, 0x08, 0x02, 0x02, 0x08, 0x37, 0x09, 0x02, 0x02, 0x07, 0x39, 0x08, 0x02, 0x01,
+  0x08, 0x3A, 0x08, 0x02, 0x01, 0x07, 0x3B, 0x08, 0x02, 0x01, 0x07, 0x3B, 0x08, 0x02, 0x00, 0x08,
+  0x3C, 0x08, 0x02, 0x00, 0x07, 0x3D, 0x08, 0x02, 0x00, 0x07, 0x3E, 0x08, 0x02, 0x00, 0x07, 0x3E,
+  0x08, 0x02, 0x00, 0x07, 0x3E, 0x08, 0x02, 0x00, 0x07, 0x3F, 0x07, 0x02, 0x00, 0x07, 0x3F, 0x08,
+  0x02, 0x00, 0x07, 0x3F, 0x08, 0x02, 0x00, 0x07, 0x3F, 0x08, 0x02, 0x00, 0x07, 0x3D, 0x0A, 0x02,
+  0x00, 0x07, 0x3D, 0x0B, 0x02, 0x00, 0x07, 0x3C, 0x0C, 0x02, 0x00, 0x08, 0x3B, 0x0C, 0x02, 0x00,
+  0x08, 0x3B, 0x0C, 0x02, 0x00, 0x08, 0x3B, 0x0C, 0x02, 0x01, 0x07, 0x3B, 0x0C, 0x02, 0x01, 0x08,
+  0x39, 0x0D, 0x02, 0x01, 0x08, 0x39, 0x0D, 0x02, 0x01, 0x09, 0x38, 0x0E, 0x02, 0x02, 0x08, 0x37,
+  0x0F, 0x02, 0x02, 0x09, 0x36, 0x0F, 0x02, 0x03, 0x08, 0x35, 0x10, 0x02, 0x03, 0x09, 0x33, 0x11,
+  0x03, 0x04, 0x09, 0x31, 0x09, 0x01, 0x08, 0x03, 0x04, 0x09, 0x30, 0x0A, 0x01, 0x08, 0x03, 0x05,
+  0x09, 0x2E, 0x0A, 0x02, 0x08, 0x03, 0x05, 0x0A, 0x2C, 0x0A, 0x03, 0x08, 0x03, 0x06, 0x0B, 0x28,
+  0x0B, 0x04, 0x08, 0x03, 0x07, 0x0B, 0x26, 0x0C, 0x04, 0x08, 0x03, 0x08, 0x0C, 0x22, 0x0D, 0x05,
+  0x08, 0x03, 0x09, 0x0D, 0x1D, 0x0F, 0x06, 0x07, 0x03, 0x0A, 0x0E, 0x18, 0x10, 0x08, 0x07, 0x03,
+  0x0B, 0x11, 0x0F, 0x14, 0x09, 0x07, 0x02, 0x0C, 0x32, 0x0A, 0x07, 0x02, 0x0D, 0x2F, 0x0B, 0x08,
+  0x02, 0x0F, 0x2B, 0x0D, 0x08, 0x02, 0x11, 0x27, 0x0F, 0x08, 0x02, 0x13, 0x23, 0x11, 0x07, 0x02,
+  0x15, 0x1E, 0x14, 0x07, 0x02, 0x19, 0x17, 0x17, 0x07, 0x02, 0x1E, 0x0C, 0x1C, 0x08, 0x01, 0x46,
+  0x08, 0x01, 0x46, 0x07, 0x01, 0x45, 0x08, 0x01, 0x45, 0x08, 0x01, 0x45, 0x07, 0x01, 0x44, 0x08,
+  0x01, 0x44, 0x08, 0x01, 0x43, 0x08, 0x01, 0x43, 0x08, 0x01, 0x42, 0x08, 0x01, 0x42, 0x08, 0x01,
+  0x41, 0x08, 0x02, 0x0B, 0x05, 0x30, 0x09, 0x02, 0x0A, 0x07, 0x2E, 0x09, 0x02, 0x0A, 0x08, 0x2C,
+  0x0A, 0x02, 0x0A, 0x08, 0x2B, 0x0A, 0x02, 0x0A, 0x09, 0x29, 0x0A, 0x02, 0x0B, 0x09, 0x27, 0x0B,
+  0x02, 0x0B, 0x0A, 0x24, 0x0C, 0x02, 0x0C, 0x0B, 0x20, 0x0D, 0x02, 0x0D, 0x0C, 0x1C, 0x0E, 0x02,
+  0x0E, 0x0D, 0x17, 0x10, 0x02, 0x0F, 0x0F, 0x11, 0x12, 0x02, 0x10, 0x15, 0x03, 0x17, 0x01, 0x11,
+  0x2D, 0x01, 0x12, 0x2A, 0x01, 0x14, 0x26, 0x01, 0x16, 0x22, 0x01, 0x18, 0x1D, 0x01, 0x1C, 0x16,
+  0x01, 0x21, 0x0B, 0x01, 0x03, 0x05, 0x01, 0x01, 0x08, 0x01, 0x01, 0x09, 0x01, 0x00, 0x0A, 0x01,
+  0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x08, 0x01, 0x02,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x02, 0x06, 0x01, 0x01, 0x08, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A,
+  0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x08, 0x01, 0x02, 0x06,
+  };
+
+const SpanGlyph ComingSoon_Regular70pt7bSpanGlyphs[] PROGMEM = {
+  {     0,  68, 102,  78,    5, -101 },   // 0x30 '0'
+  {   484,  34, 104,  44,   -1, -101 },   // 0x31 '1'
+  {   818,  71, 107,  76,    3, -103 },   // 0x32 '2'
+  {  1185,  73, 104,  77,    1, -100 },   // 0x33 '3'
+  {  1543,  67, 103,  74,    3, -100 },   // 0x34 '4'
+  {  1952,  73, 102,  81,    4, -100 },   // 0x35 '5'
+  {  2318,  79, 100,  87,    4,  -98 },   // 0x36 '6'
+  {  2782,  62, 103,  67,   -3, -100 },   // 0x37 '7'
+  {  3095,  75, 101,  86,    6,  -99 },   // 0x38 '8'
+  {  3556,  80,  99,  88,    3,  -97 },   // 0x39 '9'
+  {  4019,  10,  52,  22,    7,  -48 },   // 0x3A ':'
+  };
+
+const SpanFont ComingSoon_Regular70pt7bSpans PROGMEM = {
+  ComingSoon_Regular70pt7bSpanData, ComingSoon_Regular70pt7bSpanGlyphs, 0x30, 0x3A, 210 };
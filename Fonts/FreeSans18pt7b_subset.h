@@ -0,0 +1,224 @@
+// FreeSans18pt7b subset generated by tools/subset_fonts.py from Fonts/FreeSans18pt7b.h
+// characters:  !.0123456789:AFMOPUadeghimnprtvw
+
+const uint8_t FreeSans18pt7bBitmaps[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x20, 0x3F, 0xFC, 0xFF, 0xF0,
+  0x07, 0xE0, 0x0F, 0xF8, 0x1F, 0xFC, 0x3C, 0x3C, 0x78, 0x1E, 0x70, 0x0E,
+  0x70, 0x0E, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0F,
+  0x70, 0x0E, 0x70, 0x0E, 0x78, 0x1E, 0x3C, 0x3C, 0x1F, 0xF8, 0x1F, 0xF0,
+  0x07, 0xE0, 0x03, 0x03, 0x07, 0x0F, 0x3F, 0xFF, 0xFF, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0x70,
+  0x0F, 0xF0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF8, 0x03, 0xF0, 0x07, 0xC0, 0x1F,
+  0x00, 0x3C, 0x00, 0x38, 0x00, 0x70, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0x07, 0xFE, 0x07, 0xFF, 0x87,
+  0x83, 0xC3, 0x80, 0xF3, 0x80, 0x39, 0xC0, 0x1C, 0xE0, 0x0E, 0x00, 0x07,
+  0x00, 0x0F, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x1F, 0xE0, 0x00, 0x78, 0x00,
+  0x1E, 0x00, 0x07, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFE, 0x00, 0x77,
+  0x00, 0x73, 0xE0, 0xF8, 0xFF, 0xF8, 0x3F, 0xF8, 0x07, 0xF0, 0x00, 0x00,
+  0x38, 0x00, 0x38, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xF8, 0x01, 0xF8, 0x03,
+  0xB8, 0x03, 0x38, 0x07, 0x38, 0x0E, 0x38, 0x1C, 0x38, 0x18, 0x38, 0x38,
+  0x38, 0x70, 0x38, 0x60, 0x38, 0xE0, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+  0x38, 0x1F, 0xFF, 0x0F, 0xFF, 0x8F, 0xFF, 0xC7, 0x00, 0x03, 0x80, 0x01,
+  0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x39, 0xF0, 0x3F, 0xFE, 0x1F, 0xFF,
+  0x8F, 0x83, 0xE7, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x07, 0x00,
+  0x03, 0x80, 0x01, 0xC0, 0x00, 0xFC, 0x00, 0xEF, 0x00, 0x73, 0xC0, 0xF0,
+  0xFF, 0xF8, 0x3F, 0xF8, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x0F, 0xF8, 0x1F,
+  0xFC, 0x3C, 0x1E, 0x38, 0x0E, 0x70, 0x0E, 0x70, 0x00, 0x60, 0x00, 0xE0,
+  0x00, 0xE3, 0xE0, 0xEF, 0xF8, 0xFF, 0xFC, 0xFC, 0x3E, 0xF0, 0x0E, 0xF0,
+  0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x60, 0x07, 0x70, 0x0F, 0x70,
+  0x0E, 0x3C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x18, 0x00,
+  0x38, 0x00, 0x70, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xC0, 0x01, 0xC0, 0x01,
+  0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0E,
+  0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x07,
+  0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0x87, 0x83, 0xC7, 0x80, 0xF3, 0x80, 0x39,
+  0xC0, 0x1C, 0xE0, 0x0E, 0x78, 0x0F, 0x1E, 0x0F, 0x07, 0xFF, 0x01, 0xFF,
+  0x03, 0xFF, 0xE3, 0xE0, 0xF9, 0xC0, 0x1D, 0xC0, 0x0F, 0xE0, 0x03, 0xF0,
+  0x01, 0xF8, 0x00, 0xFC, 0x00, 0xF7, 0x00, 0x73, 0xE0, 0xF8, 0xFF, 0xF8,
+  0x3F, 0xF8, 0x07, 0xF0, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C,
+  0x3C, 0x70, 0x0E, 0xF0, 0x0E, 0xE0, 0x06, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x0F, 0x70, 0x0F, 0x78, 0x3F, 0x3F, 0xFF, 0x1F, 0xF7, 0x07,
+  0xC7, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0E, 0x70, 0x0E, 0x70, 0x1C, 0x78,
+  0x3C, 0x3F, 0xF8, 0x1F, 0xF0, 0x07, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0x80, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00,
+  0x7F, 0x00, 0x01, 0xDC, 0x00, 0x07, 0x78, 0x00, 0x3C, 0xE0, 0x00, 0xE3,
+  0x80, 0x03, 0x8F, 0x00, 0x1E, 0x1C, 0x00, 0x70, 0x70, 0x01, 0xC1, 0xE0,
+  0x0E, 0x03, 0x80, 0x38, 0x0E, 0x00, 0xE0, 0x3C, 0x07, 0xFF, 0xF0, 0x1F,
+  0xFF, 0xE0, 0xFF, 0xFF, 0x83, 0xC0, 0x0E, 0x0E, 0x00, 0x3C, 0x78, 0x00,
+  0xF1, 0xE0, 0x01, 0xC7, 0x00, 0x07, 0xBC, 0x00, 0x1E, 0xF0, 0x00, 0x3B,
+  0x80, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0E,
+  0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00,
+  0x38, 0x00, 0x1F, 0xFF, 0xCF, 0xFF, 0xE7, 0xFF, 0xF3, 0x80, 0x01, 0xC0,
+  0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07,
+  0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x00, 0xF8,
+  0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFC,
+  0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xEE, 0x00, 0x77, 0xEE, 0x00, 0x77, 0xEE,
+  0x00, 0x77, 0xE7, 0x00, 0xE7, 0xE7, 0x00, 0xE7, 0xE7, 0x00, 0xE7, 0xE3,
+  0x81, 0xC7, 0xE3, 0x81, 0xC7, 0xE3, 0x81, 0xC7, 0xE1, 0xC3, 0x87, 0xE1,
+  0xC3, 0x87, 0xE1, 0xC3, 0x87, 0xE0, 0xE7, 0x07, 0xE0, 0xE7, 0x07, 0xE0,
+  0xE7, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0,
+  0x3C, 0x07, 0xE0, 0x3C, 0x07, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xF0, 0x01,
+  0xFF, 0xFC, 0x01, 0xF0, 0x1F, 0x01, 0xE0, 0x03, 0xC1, 0xE0, 0x00, 0xF1,
+  0xE0, 0x00, 0x3C, 0xE0, 0x00, 0x0E, 0x70, 0x00, 0x07, 0x70, 0x00, 0x03,
+  0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00,
+  0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xB8, 0x00,
+  0x03, 0x9C, 0x00, 0x01, 0xCF, 0x00, 0x01, 0xE3, 0xC0, 0x01, 0xE0, 0xF0,
+  0x01, 0xE0, 0x3E, 0x03, 0xE0, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x00,
+  0x3F, 0x80, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x8F, 0xFF, 0xF3, 0x80, 0x3E,
+  0xE0, 0x03, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8,
+  0x00, 0x7E, 0x00, 0x3F, 0x80, 0x1E, 0xFF, 0xFF, 0x3F, 0xFF, 0x8F, 0xFF,
+  0xC3, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00,
+  0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x38,
+  0x00, 0x00, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E,
+  0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC,
+  0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8,
+  0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0,
+  0x00, 0x7F, 0x00, 0x1E, 0xF0, 0x07, 0x9F, 0x01, 0xF1, 0xFF, 0xFC, 0x1F,
+  0xFE, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0x0F, 0x03,
+  0xC7, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0xFE, 0x0F,
+  0xFF, 0x1F, 0xF3, 0x9F, 0x01, 0xCF, 0x00, 0xE7, 0x00, 0x73, 0x80, 0x79,
+  0xE0, 0xFC, 0x7F, 0xEF, 0x9F, 0xE3, 0xC7, 0xE1, 0xE0, 0x00, 0x03, 0x80,
+  0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E,
+  0x0F, 0xC7, 0x1F, 0xFB, 0x9F, 0xFF, 0xDF, 0x07, 0xEF, 0x01, 0xF7, 0x00,
+  0x7F, 0x80, 0x3F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8,
+  0x00, 0xFC, 0x00, 0x77, 0x00, 0x7B, 0xC0, 0x7D, 0xF0, 0x7E, 0x7F, 0xFB,
+  0x1F, 0xF9, 0x83, 0xF0, 0xC0, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C,
+  0x1E, 0x70, 0x0E, 0x60, 0x06, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x07, 0x78, 0x0E, 0x3C,
+  0x1E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0x07, 0xC7, 0x1F, 0xF7, 0x3F,
+  0xFF, 0x3C, 0x3F, 0x78, 0x0F, 0x70, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x70, 0x0F, 0x78,
+  0x0F, 0x7C, 0x3F, 0x3F, 0xF7, 0x1F, 0xE7, 0x07, 0xC7, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x0E, 0x70, 0x0E, 0x78, 0x1E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07,
+  0xE0, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00,
+  0x38, 0x00, 0x71, 0xF8, 0xE7, 0xFD, 0xDF, 0xFB, 0xF0, 0xFF, 0xC0, 0xFF,
+  0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80,
+  0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F,
+  0xC0, 0x1C, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xE3, 0xE0, 0xF8, 0xE7, 0xF1, 0xFE, 0xEF, 0xFB, 0xFE, 0xF8, 0x7F, 0x0F,
+  0xF0, 0x3E, 0x07, 0xF0, 0x1C, 0x07, 0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07,
+  0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07,
+  0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07,
+  0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07, 0xE3, 0xF1, 0xCF,
+  0xFB, 0xBF, 0xF7, 0xE1, 0xFF, 0x81, 0xFE, 0x01, 0xF8, 0x03, 0xF0, 0x07,
+  0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8,
+  0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x38, 0xE3, 0xE0, 0xE7,
+  0xF8, 0xEF, 0xFC, 0xFC, 0x3E, 0xF8, 0x1E, 0xF0, 0x0E, 0xE0, 0x0F, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xF0,
+  0x0E, 0xF8, 0x1E, 0xFC, 0x3E, 0xFF, 0xFC, 0xEF, 0xF8, 0xE3, 0xE0, 0xE0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE3,
+  0xF7, 0xFB, 0xFF, 0x8F, 0x07, 0x83, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C,
+  0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x00, 0x38, 0x70, 0xE1,
+  0xCF, 0xFF, 0xFF, 0x9C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38,
+  0x70, 0xE1, 0xC3, 0xE7, 0xC7, 0x80, 0x70, 0x03, 0xB8, 0x03, 0x9C, 0x01,
+  0xC7, 0x00, 0xE3, 0x80, 0xE1, 0xC0, 0x70, 0x70, 0x38, 0x38, 0x38, 0x1C,
+  0x1C, 0x07, 0x0E, 0x03, 0x8E, 0x01, 0xC7, 0x00, 0x77, 0x00, 0x3B, 0x80,
+  0x1D, 0xC0, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x70, 0x00, 0xF0,
+  0x1C, 0x03, 0xB8, 0x1F, 0x03, 0xDC, 0x0F, 0x81, 0xCE, 0x07, 0xC0, 0xE7,
+  0x83, 0xE0, 0x71, 0xC3, 0xB8, 0x70, 0xE1, 0xDC, 0x38, 0x70, 0xEE, 0x1C,
+  0x1C, 0x63, 0x0E, 0x0E, 0x71, 0xCE, 0x07, 0x38, 0xE7, 0x03, 0x9C, 0x73,
+  0x80, 0xEC, 0x19, 0x80, 0x7E, 0x0F, 0xC0, 0x3F, 0x07, 0xE0, 0x0F, 0x83,
+  0xF0, 0x07, 0x80, 0xF0, 0x03, 0xC0, 0x78, 0x01, 0xE0, 0x3C, 0x00,
+  };
+
+const GFXglyph FreeSans18pt7bGlyphs[] PROGMEM = {
+  {     0,   0,   0,   9,    0,    1 },   // 0x20 ' '
+  {     0,   3,  26,  12,    4,  -25 },   // 0x21 '!'
+  {     0,   0,   0,   0,    0,    0 },   // 0x22 '"'
+  {     0,   0,   0,   0,    0,    0 },   // 0x23 '#'
+  {     0,   0,   0,   0,    0,    0 },   // 0x24 '$'
+  {     0,   0,   0,   0,    0,    0 },   // 0x25 '%'
+  {     0,   0,   0,   0,    0,    0 },   // 0x26 '&'
+  {     0,   0,   0,   0,    0,    0 },   // 0x27 '''
+  {     0,   0,   0,   0,    0,    0 },   // 0x28 '('
+  {     0,   0,   0,   0,    0,    0 },   // 0x29 ')'
+  {     0,   0,   0,   0,    0,    0 },   // 0x2A '*'
+  {     0,   0,   0,   0,    0,    0 },   // 0x2B '+'
+  {     0,   0,   0,   0,    0,    0 },   // 0x2C ','
+  {     0,   0,   0,   0,    0,    0 },   // 0x2D '-'
+  {    10,   3,   4,   9,    3,   -3 },   // 0x2E '.'
+  {     0,   0,   0,   0,    0,    0 },   // 0x2F '/'
+  {    12,  16,  25,  19,    2,  -24 },   // 0x30 '0'
+  {    62,   8,  25,  19,    4,  -24 },   // 0x31 '1'
+  {    87,  16,  25,  19,    2,  -24 },   // 0x32 '2'
+  {   137,  17,  25,  19,    1,  -24 },   // 0x33 '3'
+  {   191,  16,  25,  19,    1,  -24 },   // 0x34 '4'
+  {   241,  17,  25,  19,    1,  -24 },   // 0x35 '5'
+  {   295,  16,  25,  19,    2,  -24 },   // 0x36 '6'
+  {   345,  16,  25,  19,    2,  -24 },   // 0x37 '7'
+  {   395,  17,  25,  19,    1,  -24 },   // 0x38 '8'
+  {   449,  16,  25,  19,    1,  -24 },   // 0x39 '9'
+  {   499,   3,  19,   9,    3,  -18 },   // 0x3A ':'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3B ';'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3C '<'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3D '='
+  {     0,   0,   0,   0,    0,    0 },   // 0x3E '>'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3F '?'
+  {     0,   0,   0,   0,    0,    0 },   // 0x40 '@'
+  {   507,  22,  26,  23,    1,  -25 },   // 0x41 'A'
+  {     0,   0,   0,   0,    0,    0 },   // 0x42 'B'
+  {     0,   0,   0,   0,    0,    0 },   // 0x43 'C'
+  {     0,   0,   0,   0,    0,    0 },   // 0x44 'D'
+  {     0,   0,   0,   0,    0,    0 },   // 0x45 'E'
+  {   579,  17,  26,  21,    3,  -25 },   // 0x46 'F'
+  {     0,   0,   0,   0,    0,    0 },   // 0x47 'G'
+  {     0,   0,   0,   0,    0,    0 },   // 0x48 'H'
+  {     0,   0,   0,   0,    0,    0 },   // 0x49 'I'
+  {     0,   0,   0,   0,    0,    0 },   // 0x4A 'J'
+  {     0,   0,   0,   0,    0,    0 },   // 0x4B 'K'
+  {     0,   0,   0,   0,    0,    0 },   // 0x4C 'L'
+  {   635,  24,  26,  30,    3,  -25 },   // 0x4D 'M'
+  {     0,   0,   0,   0,    0,    0 },   // 0x4E 'N'
+  {   713,  25,  26,  27,    1,  -25 },   // 0x4F 'O'
+  {   795,  18,  26,  23,    3,  -25 },   // 0x50 'P'
+  {     0,   0,   0,   0,    0,    0 },   // 0x51 'Q'
+  {     0,   0,   0,   0,    0,    0 },   // 0x52 'R'
+  {     0,   0,   0,   0,    0,    0 },   // 0x53 'S'
+  {     0,   0,   0,   0,    0,    0 },   // 0x54 'T'
+  {   854,  19,  26,  25,    3,  -25 },   // 0x55 'U'
+  {     0,   0,   0,   0,    0,    0 },   // 0x56 'V'
+  {     0,   0,   0,   0,    0,    0 },   // 0x57 'W'
+  {     0,   0,   0,   0,    0,    0 },   // 0x58 'X'
+  {     0,   0,   0,   0,    0,    0 },   // 0x59 'Y'
+  {     0,   0,   0,   0,    0,    0 },   // 0x5A 'Z'
+  {     0,   0,   0,   0,    0,    0 },   // 0x5B '['
+  {     0,   0,   0,   0,    0,    0 },   // 0x5C '\'
+  {     0,   0,   0,   0,    0,    0 },   // 0x5D ']'
+  {     0,   0,   0,   0,    0,    0 },   // 0x5E '^'
+  {     0,   0,   0,   0,    0,    0 },   // 0x5F '_'
+  {     0,   0,   0,   0,    0,    0 },   // 0x60 '`'
+  {   916,  17,  19,  19,    1,  -18 },   // 0x61 'a'
+  {     0,   0,   0,   0,    0,    0 },   // 0x62 'b'
+  {     0,   0,   0,   0,    0,    0 },   // 0x63 'c'
+  {   957,  17,  26,  20,    1,  -25 },   // 0x64 'd'
+  {  1013,  16,  19,  19,    1,  -18 },   // 0x65 'e'
+  {     0,   0,   0,   0,    0,    0 },   // 0x66 'f'
+  {  1051,  16,  27,  19,    1,  -18 },   // 0x67 'g'
+  {  1105,  15,  26,  19,    2,  -25 },   // 0x68 'h'
+  {  1154,   3,  26,   8,    2,  -25 },   // 0x69 'i'
+  {     0,   0,   0,   0,    0,    0 },   // 0x6A 'j'
+  {     0,   0,   0,   0,    0,    0 },   // 0x6B 'k'
+  {     0,   0,   0,   0,    0,    0 },   // 0x6C 'l'
+  {  1164,  24,  19,  28,    2,  -18 },   // 0x6D 'm'
+  {  1221,  15,  19,  19,    2,  -18 },   // 0x6E 'n'
+  {     0,   0,   0,   0,    0,    0 },   // 0x6F 'o'
+  {  1257,  16,  25,  20,    2,  -18 },   // 0x70 'p'
+  {     0,   0,   0,   0,    0,    0 },   // 0x71 'q'
+  {  1307,   9,  19,  12,    2,  -18 },   // 0x72 'r'
+  {     0,   0,   0,   0,    0,    0 },   // 0x73 's'
+  {  1329,   7,  23,  10,    1,  -22 },   // 0x74 't'
+  {     0,   0,   0,   0,    0,    0 },   // 0x75 'u'
+  {  1350,  17,  19,  17,    0,  -18 },   // 0x76 'v'
+  {  1391,  25,  19,  25,    0,  -18 },   // 0x77 'w'
+  };
+
+const GFXfont FreeSans18pt7b PROGMEM = {
+  (uint8_t  *)FreeSans18pt7bBitmaps,
+  (GFXglyph *)FreeSans18pt7bGlyphs,
+  0x20, 0x77, 42 };
+
+// Approx. 2074 bytes
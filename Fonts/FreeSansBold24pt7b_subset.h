@@ -0,0 +1,136 @@
+// FreeSansBold24pt7b subset generated by tools/subset_fonts.py from Fonts/FreeSansBold24pt7b.h
+// characters: !DGIMNOR
+
+const uint8_t FreeSansBold24pt7bBitmaps[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xDF, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0xC7, 0x0E, 0x1C, 0x00, 0x00, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
+  0x80, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F,
+  0xFF, 0xFF, 0xF8, 0xFE, 0x00, 0xFF, 0xCF, 0xE0, 0x03, 0xFC, 0xFE, 0x00,
+  0x1F, 0xEF, 0xE0, 0x01, 0xFE, 0xFE, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0xFE,
+  0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0,
+  0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07,
+  0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE,
+  0x00, 0x0F, 0xEF, 0xE0, 0x00, 0xFE, 0xFE, 0x00, 0x1F, 0xEF, 0xE0, 0x01,
+  0xFE, 0xFE, 0x00, 0x3F, 0xCF, 0xE0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0x8F,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+  0xF8, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xFE,
+  0x00, 0x07, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF,
+  0x01, 0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0x03, 0xFF, 0x0F, 0xF0, 0x01, 0xFE,
+  0x3F, 0xC0, 0x01, 0xFC, 0x7F, 0x00, 0x01, 0xFD, 0xFE, 0x00, 0x03, 0xFB,
+  0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
+  0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xFF, 0xFC,
+  0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0,
+  0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xBF, 0x80,
+  0x00, 0x3F, 0x7F, 0x00, 0x00, 0x7E, 0xFF, 0x00, 0x01, 0xFC, 0xFF, 0x00,
+  0x03, 0xF9, 0xFF, 0x00, 0x0F, 0xF1, 0xFF, 0x00, 0x3F, 0xE3, 0xFF, 0x83,
+  0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xDF, 0x03, 0xFF, 0xFF,
+  0x9E, 0x03, 0xFF, 0xFE, 0x3C, 0x01, 0xFF, 0xF0, 0x78, 0x00, 0x7F, 0x80,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
+  0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
+  0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
+  0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFC, 0x07, 0xFF,
+  0xFF, 0xBE, 0x03, 0xEF, 0xFF, 0xDF, 0x01, 0xF7, 0xFF, 0xEF, 0x80, 0xFB,
+  0xFF, 0xF7, 0xC0, 0xFD, 0xFF, 0xFB, 0xF0, 0x7C, 0xFF, 0xFC, 0xF8, 0x3E,
+  0x7F, 0xFE, 0x7C, 0x1F, 0x3F, 0xFF, 0x3E, 0x0F, 0x9F, 0xFF, 0x9F, 0x8F,
+  0x8F, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF1, 0xF1,
+  0xF1, 0xFF, 0xF8, 0xFC, 0xF8, 0xFF, 0xFC, 0x3E, 0xF8, 0x7F, 0xFE, 0x1F,
+  0x7C, 0x3F, 0xFF, 0x0F, 0xBE, 0x1F, 0xFF, 0x87, 0xDF, 0x0F, 0xFF, 0xC3,
+  0xFF, 0x07, 0xFF, 0xE0, 0xFF, 0x83, 0xFF, 0xF0, 0x7F, 0xC1, 0xFF, 0xF8,
+  0x3F, 0xE0, 0xFF, 0xFC, 0x1F, 0xF0, 0x7F, 0xFE, 0x07, 0xF0, 0x3F, 0xFF,
+  0x03, 0xF8, 0x1F, 0xC0, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
+  0x80, 0x07, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00,
+  0x7F, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xFF,
+  0xFF, 0x80, 0x7F, 0xFF, 0xF8, 0x07, 0xFF, 0xEF, 0xC0, 0x7F, 0xFE, 0xFE,
+  0x07, 0xFF, 0xE7, 0xE0, 0x7F, 0xFE, 0x7F, 0x07, 0xFF, 0xE3, 0xF0, 0x7F,
+  0xFE, 0x1F, 0x87, 0xFF, 0xE1, 0xFC, 0x7F, 0xFE, 0x0F, 0xC7, 0xFF, 0xE0,
+  0xFE, 0x7F, 0xFE, 0x07, 0xE7, 0xFF, 0xE0, 0x3F, 0x7F, 0xFE, 0x03, 0xFF,
+  0xFF, 0xE0, 0x1F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFE,
+  0x00, 0x7F, 0xFF, 0xE0, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xE0, 0x03,
+  0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
+  0xE0, 0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00,
+  0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
+  0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF8,
+  0x3F, 0xC0, 0x01, 0xFE, 0x1F, 0xC0, 0x00, 0x7F, 0x1F, 0xE0, 0x00, 0x3F,
+  0xCF, 0xE0, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x07, 0xF7, 0xF8, 0x00, 0x03,
+  0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
+  0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
+  0x07, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFC, 0x00,
+  0x01, 0xFE, 0xFE, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x7F, 0x3F, 0xC0,
+  0x00, 0x7F, 0x8F, 0xE0, 0x00, 0x3F, 0x87, 0xF8, 0x00, 0x3F, 0xC1, 0xFE,
+  0x00, 0x3F, 0xC0, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F,
+  0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
+  0x1F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x0F,
+  0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFE, 0x00, 0x3F, 0xEF, 0xE0, 0x01, 0xFE,
+  0xFE, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0xFE, 0xFE, 0x00, 0x0F, 0xEF, 0xE0,
+  0x00, 0xFE, 0xFE, 0x00, 0x0F, 0xEF, 0xE0, 0x01, 0xFC, 0xFE, 0x00, 0x3F,
+  0xCF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF,
+  0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x8F, 0xE0, 0x07,
+  0xF8, 0xFE, 0x00, 0x1F, 0xCF, 0xE0, 0x01, 0xFC, 0xFE, 0x00, 0x1F, 0xCF,
+  0xE0, 0x01, 0xFC, 0xFE, 0x00, 0x1F, 0xCF, 0xE0, 0x01, 0xFC, 0xFE, 0x00,
+  0x1F, 0xCF, 0xE0, 0x01, 0xFC, 0xFE, 0x00, 0x1F, 0xCF, 0xE0, 0x01, 0xFC,
+  0xFE, 0x00, 0x1F, 0xEF, 0xE0, 0x00, 0xFF,
+  };
+
+const GFXglyph FreeSansBold24pt7bGlyphs[] PROGMEM = {
+  {     0,   7,  34,  16,    5,  -33 },   // 0x21 '!'
+  {     0,   0,   0,   0,    0,    0 },   // 0x22 '"'
+  {     0,   0,   0,   0,    0,    0 },   // 0x23 '#'
+  {     0,   0,   0,   0,    0,    0 },   // 0x24 '$'
+  {     0,   0,   0,   0,    0,    0 },   // 0x25 '%'
+  {     0,   0,   0,   0,    0,    0 },   // 0x26 '&'
+  {     0,   0,   0,   0,    0,    0 },   // 0x27 '''
+  {     0,   0,   0,   0,    0,    0 },   // 0x28 '('
+  {     0,   0,   0,   0,    0,    0 },   // 0x29 ')'
+  {     0,   0,   0,   0,    0,    0 },   // 0x2A '*'
+  {     0,   0,   0,   0,    0,    0 },   // 0x2B '+'
+  {     0,   0,   0,   0,    0,    0 },   // 0x2C ','
+  {     0,   0,   0,   0,    0,    0 },   // 0x2D '-'
+  {     0,   0,   0,   0,    0,    0 },   // 0x2E '.'
+  {     0,   0,   0,   0,    0,    0 },   // 0x2F '/'
+  {     0,   0,   0,   0,    0,    0 },   // 0x30 '0'
+  {     0,   0,   0,   0,    0,    0 },   // 0x31 '1'
+  {     0,   0,   0,   0,    0,    0 },   // 0x32 '2'
+  {     0,   0,   0,   0,    0,    0 },   // 0x33 '3'
+  {     0,   0,   0,   0,    0,    0 },   // 0x34 '4'
+  {     0,   0,   0,   0,    0,    0 },   // 0x35 '5'
+  {     0,   0,   0,   0,    0,    0 },   // 0x36 '6'
+  {     0,   0,   0,   0,    0,    0 },   // 0x37 '7'
+  {     0,   0,   0,   0,    0,    0 },   // 0x38 '8'
+  {     0,   0,   0,   0,    0,    0 },   // 0x39 '9'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3A ':'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3B ';'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3C '<'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3D '='
+  {     0,   0,   0,   0,    0,    0 },   // 0x3E '>'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3F '?'
+  {     0,   0,   0,   0,    0,    0 },   // 0x40 '@'
+  {     0,   0,   0,   0,    0,    0 },   // 0x41 'A'
+  {     0,   0,   0,   0,    0,    0 },   // 0x42 'B'
+  {     0,   0,   0,   0,    0,    0 },   // 0x43 'C'
+  {    30,  28,  34,  34,    4,  -33 },   // 0x44 'D'
+  {     0,   0,   0,   0,    0,    0 },   // 0x45 'E'
+  {     0,   0,   0,   0,    0,    0 },   // 0x46 'F'
+  {   149,  31,  36,  36,    2,  -34 },   // 0x47 'G'
+  {     0,   0,   0,   0,    0,    0 },   // 0x48 'H'
+  {   289,   7,  34,  15,    4,  -33 },   // 0x49 'I'
+  {     0,   0,   0,   0,    0,    0 },   // 0x4A 'J'
+  {     0,   0,   0,   0,    0,    0 },   // 0x4B 'K'
+  {     0,   0,   0,   0,    0,    0 },   // 0x4C 'L'
+  {   319,  33,  34,  41,    4,  -33 },   // 0x4D 'M'
+  {   460,  28,  34,  35,    4,  -33 },   // 0x4E 'N'
+  {   579,  33,  36,  37,    2,  -34 },   // 0x4F 'O'
+  {     0,   0,   0,   0,    0,    0 },   // 0x50 'P'
+  {     0,   0,   0,   0,    0,    0 },   // 0x51 'Q'
+  {   728,  28,  34,  34,    4,  -33 },   // 0x52 'R'
+  };
+
+const GFXfont FreeSansBold24pt7b PROGMEM = {
+  (uint8_t  *)FreeSansBold24pt7bBitmaps,
+  (GFXglyph *)FreeSansBold24pt7bGlyphs,
+  0x21, 0x52, 56 };
+
+// Approx. 1204 bytes
@@ -1,677 +0,0 @@
-const uint8_t FreeSansBold48pt7bBitmaps[] PROGMEM = {
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xBF, 0xFE, 0xFF, 0xFB, 0xFF, 0xEF, 0xFF,
-  0x9F, 0xFE, 0x7F, 0xF1, 0xFF, 0xC7, 0xFF, 0x1F, 0xFC, 0x7F, 0xF1, 0xFF,
-  0xC3, 0xFF, 0x0F, 0xF8, 0x3F, 0xE0, 0xFF, 0x83, 0xFE, 0x0F, 0xF8, 0x3F,
-  0xE0, 0xFF, 0x81, 0xFE, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07,
-  0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x0F,
-  0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF0,
-  0x07, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF,
-  0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-  0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x07,
-  0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xF3, 0xFF, 0x80, 0x0F, 0xFE, 0x7F, 0xE0,
-  0x01, 0xFF, 0xCF, 0xFC, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x03, 0xFE, 0x1F,
-  0xE0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x00, 0xFE,
-  0x07, 0xE0, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00,
-  0x3E, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE,
-  0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0x07,
-  0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00,
-  0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00,
-  0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF8,
-  0x00, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x1F,
-  0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80,
-  0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-  0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x03,
-  0xFF, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-  0xC0, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0x00,
-  0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x00,
-  0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x00,
-  0x00, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x03, 0xFF,
-  0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x03,
-  0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0,
-  0x07, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F,
-  0xE0, 0x07, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8,
-  0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x00, 0x1F,
-  0xF8, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00,
-  0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00,
-  0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xE0,
-  0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x7F,
-  0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00,
-  0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE,
-  0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-  0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00,
-  0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-  0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0,
-  0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC,
-  0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF0, 0x1F, 0xFF, 0xE7, 0xE3, 0xFF, 0xF0, 0x1F, 0xFF, 0x87, 0xE1, 0xFF,
-  0xF8, 0x1F, 0xFE, 0x07, 0xE0, 0xFF, 0xF8, 0x3F, 0xFE, 0x07, 0xE0, 0x7F,
-  0xFC, 0x3F, 0xFC, 0x07, 0xE0, 0x3F, 0xFC, 0x3F, 0xFC, 0x07, 0xE0, 0x3F,
-  0xFC, 0x3F, 0xF8, 0x07, 0xE0, 0x3F, 0xFC, 0x3F, 0xF8, 0x07, 0xE0, 0x3F,
-  0xFC, 0x3F, 0xF8, 0x07, 0xE0, 0x3F, 0xFC, 0x3F, 0xF8, 0x07, 0xE0, 0x1F,
-  0xFE, 0x3F, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0xFC, 0x07, 0xE0, 0x00,
-  0x00, 0x3F, 0xFC, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0xFE, 0x07, 0xE0, 0x00,
-  0x00, 0x3F, 0xFF, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xC7, 0xE0, 0x00,
-  0x00, 0x1F, 0xFF, 0xF7, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-  0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00,
-  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0,
-  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE,
-  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-  0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-  0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-  0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xE3, 0xFF,
-  0xFC, 0x00, 0x00, 0x07, 0xE1, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xE0, 0x7F,
-  0xFE, 0x00, 0x00, 0x07, 0xE0, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xE0, 0x3F,
-  0xFE, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xFE, 0x00, 0x00, 0x07, 0xE0, 0x1F,
-  0xFE, 0xFF, 0xF0, 0x07, 0xE0, 0x1F, 0xFF, 0xFF, 0xF8, 0x07, 0xE0, 0x1F,
-  0xFF, 0xFF, 0xF8, 0x07, 0xE0, 0x1F, 0xFE, 0xFF, 0xF8, 0x07, 0xE0, 0x1F,
-  0xFE, 0xFF, 0xF8, 0x07, 0xE0, 0x1F, 0xFE, 0x7F, 0xFC, 0x07, 0xE0, 0x3F,
-  0xFE, 0x7F, 0xFC, 0x07, 0xE0, 0x3F, 0xFE, 0x7F, 0xFE, 0x07, 0xE0, 0x7F,
-  0xFE, 0x3F, 0xFF, 0x07, 0xE0, 0xFF, 0xFC, 0x3F, 0xFF, 0x87, 0xE1, 0xFF,
-  0xFC, 0x3F, 0xFF, 0xE7, 0xE7, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE,
-  0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-  0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07,
-  0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-  0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-  0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-  0x03, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xE0,
-  0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-  0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-  0xFF, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x3F, 0xFC,
-  0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F,
-  0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xC0, 0x00,
-  0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-  0xE0, 0x00, 0x3F, 0xE0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-  0x7F, 0xE0, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xC0,
-  0x07, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xC0,
-  0x00, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x00,
-  0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-  0x00, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x3F,
-  0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x1F,
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xC0, 0x3F, 0x80, 0x00,
-  0x00, 0x00, 0x7F, 0xF8, 0x0F, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
-  0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0x80,
-  0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xE0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x3F,
-  0xC0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F,
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x7F, 0xFF, 0xE0,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-  0x1F, 0xC0, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0xFF, 0xFF,
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xE0,
-  0x00, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFF, 0x87, 0xFF, 0xC0, 0x00, 0x00,
-  0x00, 0x1F, 0xC0, 0x3F, 0xF8, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-  0x80, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x01, 0xFF,
-  0x80, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xFC, 0x00, 0x07, 0xFE, 0x00,
-  0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-  0x3F, 0x80, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00,
-  0x3F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xC0,
-  0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0xFF,
-  0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00,
-  0x00, 0x3F, 0x80, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x07,
-  0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xFF, 0x81,
-  0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0x7F, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00,
-  0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F,
-  0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-  0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00,
-  0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFE,
-  0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-  0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-  0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0,
-  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x3F,
-  0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-  0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFC,
-  0x00, 0x00, 0x01, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF,
-  0x00, 0x3F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00,
-  0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x03,
-  0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x7F, 0xF8, 0x00, 0x00, 0x00,
-  0xFF, 0xFC, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0xFF, 0xF0,
-  0x00, 0x00, 0x00, 0x7F, 0xFF, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-  0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-  0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
-  0x80, 0x0F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xE0, 0x03,
-  0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xE0, 0x0F, 0xFF, 0xF3, 0xFF, 0xF8, 0x0F, 0xFE, 0x01, 0xFF, 0xFE,
-  0x3F, 0xFF, 0x80, 0xFF, 0xE0, 0x3F, 0xFF, 0x81, 0xFF, 0xFC, 0x1F, 0xFC,
-  0x03, 0xFF, 0xF0, 0x0F, 0xFF, 0xE1, 0xFF, 0xC0, 0x7F, 0xFE, 0x00, 0x7F,
-  0xFF, 0x1F, 0xFC, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xFB, 0xFF, 0xC0, 0x7F,
-  0xF8, 0x00, 0x3F, 0xFF, 0xBF, 0xF8, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
-  0xFF, 0x80, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0x80,
-  0x00, 0x7F, 0xFF, 0xFF, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF0,
-  0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF,
-  0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-  0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x07, 0xFF, 0xE0,
-  0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-  0x07, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x3F,
-  0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
-  0xFF, 0xFF, 0xF7, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-  0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF,
-  0xE0, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x00,
-  0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFB, 0xFF, 0xCF, 0xFE, 0x7F, 0xE3, 0xFF, 0x0F, 0xF8, 0x7F, 0x83, 0xFC,
-  0x1F, 0xE0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x0F,
-  0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
-  0xF0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x01, 0xFF,
-  0xC0, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-  0x80, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFE,
-  0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFC,
-  0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF8,
-  0x00, 0x7F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF0,
-  0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0,
-  0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0,
-  0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0,
-  0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xF0,
-  0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0,
-  0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF8,
-  0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFC,
-  0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFE,
-  0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF,
-  0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x01, 0xFF,
-  0xC0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x7F,
-  0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
-  0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x03,
-  0xFE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xE0,
-  0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF,
-  0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-  0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00,
-  0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xC0,
-  0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x07, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x01,
-  0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFE, 0x00,
-  0x0F, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xE0,
-  0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xFF,
-  0x00, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0xFF,
-  0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x0F,
-  0xFF, 0x00, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00,
-  0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFC, 0x00,
-  0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x80,
-  0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xF0,
-  0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFE,
-  0x00, 0x0F, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF,
-  0x80, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0xFF,
-  0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x1F,
-  0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x07,
-  0xFE, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x01,
-  0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F,
-  0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F,
-  0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F,
-  0xE0, 0x00, 0x30, 0x0F, 0xE0, 0x0C, 0x3E, 0x0F, 0xE0, 0x7C, 0x7F, 0xCF,
-  0xE3, 0xFC, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-  0xFF, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFE,
-  0xFF, 0x80, 0x03, 0xFE, 0x7F, 0x80, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8,
-  0x3F, 0xE0, 0x0F, 0xF8, 0x1F, 0xE0, 0x07, 0xF0, 0x0F, 0xE0, 0x01, 0xE0,
-  0x07, 0x80, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-  0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F,
-  0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-  0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-  0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-  0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-  0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-  0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F,
-  0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-  0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-  0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x7F, 0x01,
-  0xF8, 0x0F, 0xE0, 0x7F, 0x83, 0xFC, 0x3F, 0xE3, 0xFF, 0x8F, 0xFC, 0x3F,
-  0xC0, 0xFC, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00,
-  0x00, 0x7E, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0,
-  0x00, 0x01, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07,
-  0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00,
-  0x1F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00,
-  0x00, 0x3F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC,
-  0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x03,
-  0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-  0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x80,
-  0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F,
-  0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-  0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00,
-  0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xC0,
-  0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F,
-  0x80, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00,
-  0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xF8, 0x00,
-  0x00, 0x7E, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0,
-  0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07,
-  0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-  0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-  0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-  0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xF8,
-  0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x7F, 0xFC, 0x00,
-  0x1F, 0xFF, 0x83, 0xFF, 0xF0, 0x00, 0x3F, 0xFE, 0x0F, 0xFF, 0x80, 0x00,
-  0xFF, 0xF8, 0x3F, 0xFE, 0x00, 0x01, 0xFF, 0xF1, 0xFF, 0xF0, 0x00, 0x07,
-  0xFF, 0xC7, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x1F, 0xFF, 0x00, 0x00, 0x7F,
-  0xFC, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xEF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xBF, 0xFE, 0x00, 0x00, 0x3F, 0xFE,
-  0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xEF,
-  0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xBF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0xFF,
-  0xF8, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xEF, 0xFF,
-  0x80, 0x00, 0x0F, 0xFF, 0xBF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80,
-  0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-  0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-  0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-  0xFF, 0xFB, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0x80, 0x00, 0x0F,
-  0xFF, 0xBF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
-  0xFB, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
-  0xBF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF9,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE7, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x1F,
-  0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x7F, 0xFC, 0x00, 0x01, 0xFF, 0xF0, 0xFF,
-  0xF8, 0x00, 0x0F, 0xFF, 0xC3, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0x0F, 0xFF,
-  0xC0, 0x01, 0xFF, 0xF8, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x7F, 0xFF,
-  0x00, 0x7F, 0xFF, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF,
-  0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-  0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-  0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF,
-  0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x00,
-  0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF0,
-  0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-  0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-  0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F,
-  0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-  0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF0,
-  0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-  0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-  0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F,
-  0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-  0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF0,
-  0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-  0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-  0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F,
-  0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-  0xC0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-  0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-  0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
-  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC3, 0xFF, 0xF8, 0x00,
-  0x7F, 0xFF, 0x1F, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x07,
-  0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xFB, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xDF, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF7, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xBF,
-  0xFC, 0x00, 0x00, 0x7F, 0xFD, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xEF, 0xFF,
-  0x00, 0x00, 0x1F, 0xFF, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00,
-  0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x01,
-  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF,
-  0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFE,
-  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00,
-  0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-  0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-  0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-  0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80,
-  0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF,
-  0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-  0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00,
-  0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x01,
-  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0x00,
-  0x0F, 0xFF, 0xE1, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x87, 0xFF, 0xC0, 0x00,
-  0x7F, 0xFE, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xF8, 0x7F, 0xF8, 0x00, 0x03,
-  0xFF, 0xE1, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x87, 0xFF, 0x80, 0x00, 0x3F,
-  0xFE, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 0xF8, 0x7F, 0xF8, 0x00, 0x03, 0xFF,
-  0xE1, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-  0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-  0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x01,
-  0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
-  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07,
-  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F,
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-  0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xEF,
-  0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xBF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0xFF,
-  0xF8, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xEF, 0xFF,
-  0xC0, 0x00, 0x1F, 0xFF, 0x9F, 0xFF, 0x80, 0x00, 0xFF, 0xFE, 0x7F, 0xFF,
-  0x00, 0x07, 0xFF, 0xF1, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xC3, 0xFF, 0xFE,
-  0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-  0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-  0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-  0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-  0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0,
-  0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-  0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-  0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00,
-  0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF7, 0xFF, 0xC0, 0x00,
-  0x00, 0x7F, 0xCF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x9F, 0xFF, 0x00, 0x00,
-  0x07, 0xFE, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xFC, 0x00, 0x00,
-  0x3F, 0xF0, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0xF0, 0x00, 0x01,
-  0xFF, 0x83, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xF8, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x1F, 0xFF, 0x00, 0x00, 0x7F,
-  0xC0, 0x3F, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x7F, 0xFC, 0x00, 0x07, 0xFE,
-  0x00, 0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0xF0, 0x00, 0x3F, 0xF0,
-  0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x07, 0xFF, 0xC0, 0x01, 0xFF, 0x80,
-  0x0F, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xF8, 0x00,
-  0x3F, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xC0, 0x00,
-  0xFF, 0xF8, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x07, 0xFE, 0x00, 0x03,
-  0xFF, 0xE0, 0x0F, 0xF8, 0x00, 0x07, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x0F,
-  0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x1F, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0,
-  0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-  0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-  0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-  0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x0F, 0xFF, 0xE0, 0x00, 0x1F,
-  0xFC, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xEF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xF9,
-  0xFF, 0xFF, 0xE0, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x83, 0xFF, 0xE0, 0x00,
-  0xFF, 0xFF, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x3F, 0xFC, 0x00, 0x03,
-  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-  0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-  0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xBF, 0xFE,
-  0x00, 0x00, 0x7F, 0xFE, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFB, 0xFF, 0xF0,
-  0x00, 0x0F, 0xFF, 0xCF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x3F, 0xFF, 0x80,
-  0x01, 0xFF, 0xFC, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0xE1, 0xFF, 0xFF, 0x81,
-  0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF,
-  0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80,
-  0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-  0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-  0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x01,
-  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFC,
-  0x03, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x3F, 0xFE, 0x00,
-  0x07, 0xFF, 0xC1, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x07, 0xFF, 0xC0, 0x00,
-  0x3F, 0xFC, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x7F, 0xF8, 0x01, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x7F, 0xFF, 0x00, 0x07,
-  0xFF, 0x87, 0xFF, 0xFF, 0x00, 0x3F, 0xFE, 0x3F, 0xFF, 0xFF, 0x00, 0xFF,
-  0xF9, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xEF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
-  0xEF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0x03, 0xFF, 0xFC, 0xFF, 0xFF, 0x80,
-  0x07, 0xFF, 0xF3, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xE0, 0x00,
-  0x1F, 0xFF, 0xBF, 0xFF, 0x80, 0x00, 0x3F, 0xFE, 0xFF, 0xFC, 0x00, 0x00,
-  0xFF, 0xFB, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xEF, 0xFF, 0x80, 0x00, 0x07,
-  0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F,
-  0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF7, 0xFF, 0x80, 0x00, 0x07, 0xFF,
-  0xDF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xFD,
-  0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF7, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x9F,
-  0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE3, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x87, 0xFF,
-  0xC0, 0x00, 0xFF, 0xFC, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xF0, 0x7F, 0xFF,
-  0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-  0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF,
-  0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-  0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
-  0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-  0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-  0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-  0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-  0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-  0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-  0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-  0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x81, 0xFF, 0xF8,
-  0x00, 0x3F, 0xFF, 0x03, 0xFF, 0xE0, 0x00, 0x1F, 0xFE, 0x07, 0xFF, 0x80,
-  0x00, 0x3F, 0xFE, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00,
-  0x00, 0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xF0, 0x00,
-  0x00, 0xFF, 0xE1, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0xC0, 0x00,
-  0x03, 0xFF, 0x83, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x07, 0xFF, 0x00, 0x00,
-  0x1F, 0xFE, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00,
-  0xFF, 0xF0, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x0F,
-  0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-  0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-  0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC,
-  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE,
-  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-  0x01, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x07, 0xFF, 0xF0, 0x00, 0xFF, 0xFC,
-  0x1F, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xFC,
-  0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF9, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF3,
-  0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF,
-  0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-  0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-  0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-  0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-  0x80, 0x00, 0x0F, 0xFF, 0xDF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xBF, 0xFF,
-  0x80, 0x00, 0x7F, 0xFE, 0x7F, 0xFF, 0x80, 0x01, 0xFF, 0xFC, 0x7F, 0xFF,
-  0x80, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xE0, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
-  0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-  0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-  0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-  0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC,
-  0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0,
-  0x3F, 0xFF, 0x00, 0x0F, 0xFF, 0xC1, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x07,
-  0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xF8, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xE3, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xCF, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0xFF, 0xF0,
-  0x00, 0x00, 0xFF, 0xF3, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0x00,
-  0x00, 0x0F, 0xFF, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xF0, 0x00,
-  0x00, 0xFF, 0xFB, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0x00, 0x00,
-  0x0F, 0xFF, 0xBF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xFB, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0x3F,
-  0xFF, 0x9F, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x7F, 0xFE, 0x00, 0x07, 0xFF,
-  0xF9, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xE3, 0xFF, 0xF8, 0x01, 0xFF, 0xFF,
-  0x8F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F,
-  0xFF, 0xFF, 0xFB, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xCF, 0xFF, 0x80, 0x1F,
-  0xFF, 0xFE, 0x3F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0xFF, 0xF8, 0x00, 0x1F,
-  0xFF, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0x80, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0x03, 0xFF, 0xE1, 0xFF, 0xE0, 0x00, 0x0F,
-  0xFF, 0x87, 0xFF, 0xC0, 0x00, 0x7F, 0xFC, 0x1F, 0xFF, 0x00, 0x01, 0xFF,
-  0xF0, 0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0xC1, 0xFF, 0xFC, 0x00, 0x7F, 0xFE,
-  0x03, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F,
-  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  };
-
-const GFXglyph FreeSansBold48pt7bGlyphs[] PROGMEM = {
-  {     0,   1,   1,  26,    0,    0 },   // 0x20 ' '
-  {     1,  14,  68,  31,   11,  -67 },   // 0x21 '!'
-  {   120,  35,  25,  45,    5,  -68 },   // 0x22 '"'
-  {   230,  52,  69,  52,    0,  -65 },   // 0x23 '#'
-  {   679,  48,  84,  52,    2,  -71 },   // 0x24 '$'
-  {  1183,  79,  69,  84,    2,  -66 },   // 0x25 '%'
-  {  1865,  60,  70,  68,    5,  -67 },   // 0x26 '&'
-  {  2390,  13,  25,  22,    5,  -68 },   // 0x27 '''
-  {  2431,  24,  88,  31,    4,  -68 },   // 0x28 '('
-  {  2695,  25,  88,  31,    2,  -68 },   // 0x29 ')'
-  {  2970,  32,  31,  37,    2,  -68 },   // 0x2A '*'
-  {  3094,  45,  45,  55,    5,  -43 },   // 0x2B '+'
-  {  3348,  14,  30,  26,    6,  -13 },   // 0x2C ','
-  {  3401,  26,  13,  31,    2,  -31 },   // 0x2D '-'
-  {  3444,  14,  14,  26,    6,  -13 },   // 0x2E '.'
-  {  3469,  26,  68,  26,    0,  -66 },   // 0x2F '/'
-  {  3690,  46,  70,  52,    3,  -67 },   // 0x30 '0'
-  {  4093,  30,  67,  52,    6,  -66 },   // 0x31 '1'
-  {  4345,  45,  68,  52,    3,  -67 },   // 0x32 '2'
-  {  4728,  46,  70,  52,    3,  -67 },   // 0x33 '3'
-  {  5131,  47,  67,  52,    2,  -66 },   // 0x34 '4'
-  {  5525,  46,  69,  52,    3,  -66 },   // 0x35 '5'
-  {  5922,  46,  70,  52,    3,  -67 },   // 0x36 '6'
-  {  6325,  47,  67,  52,    3,  -66 },   // 0x37 '7'
-  {  6719,  47,  70,  52,    2,  -67 },   // 0x38 '8'
-  {  7131,  46,  70,  52,    3,  -67 },   // 0x39 '9'
-  {  7534,  14,  49,  31,   11,  -48 },   // 0x3A ':'
-  };
-
-const GFXfont FreeSansBold48pt7b PROGMEM = {
-  (uint8_t  *)FreeSansBold48pt7bBitmaps,
-  (GFXglyph *)FreeSansBold48pt7bGlyphs,
-  0x20, 0x7E, 151 };
-
-// Approx. 33503 bytes
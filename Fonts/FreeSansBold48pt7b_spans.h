@@ -0,0 +1,189 @@
+// FreeSansBold48pt7b span encoded by tools/gfxfont_to_spanfont.py from Fonts/FreeSansBold48pt7b.h
+// characters: 0123456789:
+// 2651 span bytes, 3930 bytes as GFXfont bitmap
+
+const uint8_t FreeSansBold48pt7bSpanData[] PROGMEM = {
+  0x01, 0x11, 0x0B, 0x01, 0x0E, 0x11, 0x01, 0x0C, 0x15, 0x01, 0x0A, 0x19, 0x01, 0x09, 0x1B, 0x01,
+  0x08, 0x1D, 0x01, 0x07, 0x1F, 0x01, 0x06, 0x21, 0x01, 0x05, 0x23, 0x01, 0x05, 0x24, 0x01, 0x04,
+  0x25, 0x02, 0x04, 0x0F, 0x08, 0x0F, 0x02, 0x03, 0x0E, 0x0B, 0x0E, 0x02, 0x03, 0x0D, 0x0D, 0x0E,
+  0x02, 0x02, 0x0E, 0x0E, 0x0D, 0x02, 0x02, 0x0D, 0x0F, 0x0D, 0x02, 0x02, 0x0D, 0x10, 0x0D, 0x02,
+  0x01, 0x0D, 0x11, 0x0D, 0x02, 0x01, 0x0D, 0x11, 0x0D, 0x02, 0x01, 0x0D, 0x11, 0x0D, 0x02, 0x01,
+  0x0D, 0x12, 0x0C, 0x02, 0x01, 0x0D, 0x12, 0x0D, 0x02, 0x00, 0x0D, 0x13, 0x0D, 0x02, 0x00, 0x0D,
+  0x13, 0x0D, 0x02, 0x00, 0x0D, 0x13, 0x0D, 0x02, 0x00, 0x0D, 0x13, 0x0D, 0x02, 0x00, 0x0D, 0x13,
+  0x0D, 0x02, 0x00, 0x0D, 0x13, 0x0D, 0x02, 0x00, 0x0D, 0x13, 0x0D, 0x02, 0x00, 0x0D, 0x13, 0x0D,
+  0x02, 0x00, 0x0D, 0x13, 0x0D, 0x02, 0x00, 0x0D, 0x13, 0x0E, 0x02, 0x00, 0x0D, 0x13, 0x0E, 0x02,
+  0x00, 0x0D, 0x13, 0x0E, 0x02, 0x00, 0x0D, 0x13, 0x0E, 0x02, 0x00, 0x0D, 0x13, 0x0E, 0x02, 0x00,
+  0x0D, 0x13, 0x0E, 0x02, 0x00, 0x0D, 0x13, 0x0E, 0x02, 0x00, 0x0D, 0x13, 0x0E, 0x02, 0x00, 0x0D,
+  0x13, 0x0E, 0x02, 0x00, 0x0D, 0x13, 0x0D, 0x02, 0x00, 0x0D, 0x13, 0x0D, 0x02, 0x00, 0x0D, 0x13,
+  0x0D, 0x02, 0x00, 0x0D, 0x13, 0x0D, 0x02, 0x00, 0x0D, 0x13, 0x0D, 0x02, 0x00, 0x0D, 0x13, 0x0D,
+  0x02, 0x00, 0x0D, 0x13, 0x0D, 0x02, 0x00, 0x0D, 0x13, 0x0D, 0x02, 0x01, 0x0D, 0x12, 0x0D, 0x02,
+  0x01, 0x0D, 0x12, 0x0D, 0x02, 0x01, 0x0D, 0x11, 0x0D, 0x02, 0x01, 0x0D, 0x11, 0x0D, 0x02, 0x01,
+  0x0D, 0x11, 0x0D, 0x02, 0x02, 0x0D, 0x0F, 0x0E, 0x02, 0x02, 0x0D, 0x0F, 0x0D, 0x02, 0x02, 0x0E,
+  0x0D, 0x0E, 0x02, 0x03, 0x0E, 0x0B, 0x0F, 0x02, 0x03, 0x0F, 0x09, 0x0F, 0x02, 0x03, 0x11, 0x05,
+  0x11, 0x01, 0x04, 0x25, 0x01, 0x05, 0x24, 0x01, 0x05, 0x23, 0x01, 0x06, 0x21, 0x01, 0x07, 0x1F,
+  0x01, 0x08, 0x1D, 0x01, 0x09, 0x1B, 0x01, 0x0A, 0x19, 0x01, 0x0C, 0x15, 0x01, 0x0E, 0x11, 0x01,
+  0x11, 0x0B, 0x01, 0x15, 0x09, 0x01, 0x14, 0x0A, 0x01, 0x14, 0x0A, 0x01, 0x14, 0x0A, 0x01, 0x13,
+  0x0B, 0x01, 0x12, 0x0C, 0x01, 0x12, 0x0C, 0x01, 0x11, 0x0D, 0x01, 0x0F, 0x0F, 0x01, 0x0E, 0x10,
+  0x01, 0x0C, 0x12, 0x01, 0x08, 0x16, 0x01, 0x00, 0x1E, 0x01, 0x00, 0x1E, 0x01, 0x00, 0x1E, 0x01,
+  0x00, 0x1E, 0x01, 0x00, 0x1E, 0x01, 0x00, 0x1E, 0x01, 0x00, 0x1E, 0x01, 0x00, 0x1E, 0x01, 0x00,
+  0x1E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E,
+  0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01,
+  0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10,
+  0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E,
+  0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01,
+  0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10,
+  0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E,
+  0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01,
+  0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x10, 0x0E, 0x01, 0x11, 0x0C, 0x01, 0x0D,
+  0x13, 0x01, 0x0B, 0x18, 0x01, 0x09, 0x1C, 0x01, 0x08, 0x1E, 0x01, 0x07, 0x20, 0x01, 0x06, 0x22,
+  0x01, 0x05, 0x24, 0x01, 0x04, 0x26, 0x01, 0x04, 0x26, 0x01, 0x03, 0x28, 0x02, 0x03, 0x10, 0x08,
+  0x10, 0x02, 0x02, 0x0F, 0x0C, 0x0F, 0x02, 0x02, 0x0E, 0x0E, 0x0E, 0x02, 0x02, 0x0D, 0x10, 0x0E,
+  0x02, 0x01, 0x0E, 0x10, 0x0E, 0x02, 0x01, 0x0D, 0x12, 0x0D, 0x02, 0x01, 0x0D, 0x12, 0x0D, 0x02,
+  0x01, 0x0D, 0x12, 0x0D, 0x02, 0x01, 0x0D, 0x12, 0x0D, 0x02, 0x01, 0x0C, 0x13, 0x0D, 0x02, 0x01,
+  0x0C, 0x13, 0x0D, 0x02, 0x01, 0x0C, 0x13, 0x0D, 0x02, 0x01, 0x0C, 0x13, 0x0D, 0x02, 0x01, 0x0C,
+  0x13, 0x0D, 0x01, 0x20, 0x0D, 0x01, 0x1F, 0x0E, 0x01, 0x1F, 0x0E, 0x01, 0x1F, 0x0D, 0x01, 0x1E,
+  0x0E, 0x01, 0x1D, 0x0E, 0x01, 0x1C, 0x0F, 0x01, 0x1B, 0x0F, 0x01, 0x1A, 0x10, 0x01, 0x19, 0x10,
+  0x01, 0x18, 0x10, 0x01, 0x17, 0x10, 0x01, 0x15, 0x11, 0x01, 0x14, 0x11, 0x01, 0x13, 0x11, 0x01,
+  0x11, 0x12, 0x01, 0x10, 0x11, 0x01, 0x0F, 0x11, 0x01, 0x0D, 0x12, 0x01, 0x0C, 0x11, 0x01, 0x0B,
+  0x11, 0x01, 0x09, 0x12, 0x01, 0x08, 0x11, 0x01, 0x07, 0x11, 0x01, 0x06, 0x11, 0x01, 0x05, 0x11,
+  0x01, 0x05, 0x10, 0x01, 0x04, 0x10, 0x01, 0x03, 0x10, 0x01, 0x03, 0x0F, 0x01, 0x02, 0x0F, 0x01,
+  0x02, 0x2B, 0x01, 0x02, 0x2B, 0x01, 0x01, 0x2C, 0x01, 0x01, 0x2C, 0x01, 0x01, 0x2C, 0x01, 0x01,
+  0x2C, 0x01, 0x00, 0x2D, 0x01, 0x00, 0x2D, 0x01, 0x00, 0x2D, 0x01, 0x00, 0x2D, 0x01, 0x00, 0x2D,
+  0x01, 0x00, 0x2D, 0x01, 0x10, 0x0C, 0x01, 0x0D, 0x13, 0x01, 0x0A, 0x18, 0x01, 0x09, 0x1B, 0x01,
+  0x07, 0x1E, 0x01, 0x06, 0x20, 0x01, 0x05, 0x22, 0x01, 0x04, 0x24, 0x01, 0x04, 0x25, 0x01, 0x03,
+  0x26, 0x01, 0x03, 0x27, 0x02, 0x02, 0x0F, 0x09, 0x10, 0x02, 0x02, 0x0E, 0x0C, 0x0F, 0x02, 0x01,
+  0x0E, 0x0E, 0x0E, 0x02, 0x01, 0x0D, 0x0F, 0x0E, 0x02, 0x01, 0x0D, 0x10, 0x0D, 0x02, 0x01, 0x0C,
+  0x11, 0x0D, 0x02, 0x01, 0x0C, 0x11, 0x0D, 0x02, 0x01, 0x0C, 0x11, 0x0D, 0x02, 0x01, 0x0C, 0x11,
+  0x0D, 0x02, 0x01, 0x0C, 0x11, 0x0D, 0x02, 0x01, 0x0C, 0x11, 0x0D, 0x01, 0x1E, 0x0D, 0x01, 0x1E,
+  0x0C, 0x01, 0x1D, 0x0D, 0x01, 0x1C, 0x0E, 0x01, 0x1C, 0x0D, 0x01, 0x1A, 0x0E, 0x01, 0x18, 0x0F,
+  0x01, 0x11, 0x15, 0x01, 0x11, 0x14, 0x01, 0x11, 0x13, 0x01, 0x11, 0x12, 0x01, 0x11, 0x14, 0x01,
+  0x11, 0x15, 0x01, 0x11, 0x17, 0x01, 0x11, 0x18, 0x01, 0x11, 0x19, 0x01, 0x17, 0x13, 0x01, 0x1B,
+  0x10, 0x01, 0x1C, 0x10, 0x01, 0x1E, 0x0E, 0x01, 0x1E, 0x0E, 0x01, 0x1F, 0x0E, 0x01, 0x20, 0x0D,
+  0x01, 0x20, 0x0D, 0x01, 0x20, 0x0D, 0x01, 0x20, 0x0D, 0x02, 0x00, 0x0D, 0x13, 0x0D, 0x02, 0x00,
+  0x0D, 0x13, 0x0D, 0x02, 0x00, 0x0D, 0x13, 0x0D, 0x02, 0x00, 0x0D, 0x13, 0x0D, 0x02, 0x00, 0x0D,
+  0x13, 0x0D, 0x02, 0x00, 0x0E, 0x11, 0x0E, 0x02, 0x00, 0x0E, 0x11, 0x0E, 0x02, 0x01, 0x0E, 0x0F,
+  0x0F, 0x02, 0x01, 0x0F, 0x0D, 0x0F, 0x02, 0x01, 0x10, 0x0B, 0x10, 0x02, 0x02, 0x11, 0x06, 0x13,
+  0x01, 0x02, 0x29, 0x01, 0x03, 0x27, 0x01, 0x03, 0x27, 0x01, 0x04, 0x25, 0x01, 0x05, 0x23, 0x01,
+  0x06, 0x21, 0x01, 0x07, 0x1F, 0x01, 0x08, 0x1C, 0x01, 0x0A, 0x18, 0x01, 0x0C, 0x14, 0x01, 0x10,
+  0x0D, 0x01, 0x19, 0x0F, 0x01, 0x18, 0x10, 0x01, 0x17, 0x11, 0x01, 0x17, 0x11, 0x01, 0x16, 0x12,
+  0x01, 0x16, 0x12, 0x01, 0x15, 0x13, 0x01, 0x14, 0x14, 0x01, 0x14, 0x14, 0x01, 0x13, 0x15, 0x01,
+  0x13, 0x15, 0x01, 0x12, 0x16, 0x01, 0x11, 0x17, 0x01, 0x11, 0x17, 0x02, 0x10, 0x0A, 0x01, 0x0D,
+  0x02, 0x10, 0x09, 0x02, 0x0D, 0x02, 0x0F, 0x0A, 0x02, 0x0D, 0x02, 0x0E, 0x0A, 0x03, 0x0D, 0x02,
+  0x0E, 0x0A, 0x03, 0x0D, 0x02, 0x0D, 0x0A, 0x04, 0x0D, 0x02, 0x0D, 0x09, 0x05, 0x0D, 0x02, 0x0C,
+  0x0A, 0x05, 0x0D, 0x02, 0x0B, 0x0A, 0x06, 0x0D, 0x02, 0x0B, 0x09, 0x07, 0x0D, 0x02, 0x0A, 0x0A,
+  0x07, 0x0D, 0x02, 0x0A, 0x09, 0x08, 0x0D, 0x02, 0x09, 0x0A, 0x08, 0x0D, 0x02, 0x08, 0x0A, 0x09,
+  0x0D, 0x02, 0x08, 0x09, 0x0A, 0x0D, 0x02, 0x07, 0x0A, 0x0A, 0x0D, 0x02, 0x07, 0x09, 0x0B, 0x0D,
+  0x02, 0x06, 0x0A, 0x0B, 0x0D, 0x02, 0x05, 0x0A, 0x0C, 0x0D, 0x02, 0x05, 0x09, 0x0D, 0x0D, 0x02,
+  0x04, 0x0A, 0x0D, 0x0D, 0x02, 0x04, 0x09, 0x0E, 0x0D, 0x02, 0x03, 0x0A, 0x0E, 0x0D, 0x02, 0x02,
+  0x0A, 0x0F, 0x0D, 0x02, 0x02, 0x09, 0x10, 0x0D, 0x02, 0x01, 0x0A, 0x10, 0x0D, 0x02, 0x01, 0x09,
+  0x11, 0x0D, 0x01, 0x00, 0x2F, 0x01, 0x00, 0x2F, 0x01, 0x00, 0x2F, 0x01, 0x00, 0x2F, 0x01, 0x00,
+  0x2F, 0x01, 0x00, 0x2F, 0x01, 0x00, 0x2F, 0x01, 0x00, 0x2F, 0x01, 0x00, 0x2F, 0x01, 0x00, 0x2F,
+  0x01, 0x00, 0x2F, 0x01, 0x1B, 0x0D, 0x01, 0x1B, 0x0D, 0x01, 0x1B, 0x0D, 0x01, 0x1B, 0x0D, 0x01,
+  0x1B, 0x0D, 0x01, 0x1B, 0x0D, 0x01, 0x1B, 0x0D, 0x01, 0x1B, 0x0D, 0x01, 0x1B, 0x0D, 0x01, 0x1B,
+  0x0D, 0x01, 0x1B, 0x0D, 0x01, 0x1B, 0x0D, 0x01, 0x1B, 0x0D, 0x01, 0x1B, 0x0D, 0x01, 0x1B, 0x0D,
+  0x01, 0x07, 0x24, 0x01, 0x07, 0x24, 0x01, 0x07, 0x24, 0x01, 0x07, 0x24, 0x01, 0x07, 0x24, 0x01,
+  0x07, 0x24, 0x01, 0x06, 0x25, 0x01, 0x06, 0x25, 0x01, 0x06, 0x25, 0x01, 0x06, 0x25, 0x01, 0x06,
+  0x25, 0x01, 0x06, 0x25, 0x01, 0x05, 0x0A, 0x01, 0x05, 0x0A, 0x01, 0x05, 0x0A, 0x01, 0x05, 0x0A,
+  0x01, 0x05, 0x0A, 0x01, 0x05, 0x0A, 0x01, 0x04, 0x0A, 0x01, 0x04, 0x0A, 0x01, 0x04, 0x0A, 0x01,
+  0x04, 0x0A, 0x02, 0x04, 0x0A, 0x06, 0x0A, 0x02, 0x04, 0x0A, 0x04, 0x0F, 0x02, 0x03, 0x0B, 0x02,
+  0x13, 0x02, 0x03, 0x0A, 0x01, 0x17, 0x01, 0x03, 0x23, 0x01, 0x03, 0x24, 0x01, 0x03, 0x25, 0x01,
+  0x03, 0x26, 0x01, 0x03, 0x26, 0x01, 0x02, 0x28, 0x02, 0x02, 0x13, 0x02, 0x14, 0x02, 0x02, 0x0F,
+  0x0A, 0x10, 0x02, 0x02, 0x0D, 0x0D, 0x10, 0x02, 0x02, 0x0C, 0x0F, 0x0F, 0x02, 0x02, 0x0C, 0x10,
+  0x0E, 0x01, 0x1F, 0x0E, 0x01, 0x1F, 0x0E, 0x01, 0x20, 0x0D, 0x01, 0x20, 0x0D, 0x01, 0x20, 0x0D,
+  0x01, 0x20, 0x0D, 0x01, 0x20, 0x0E, 0x01, 0x20, 0x0E, 0x01, 0x20, 0x0E, 0x01, 0x20, 0x0E, 0x01,
+  0x20, 0x0D, 0x01, 0x20, 0x0D, 0x01, 0x20, 0x0D, 0x02, 0x00, 0x0D, 0x13, 0x0D, 0x02, 0x00, 0x0D,
+  0x12, 0x0E, 0x02, 0x00, 0x0D, 0x12, 0x0E, 0x02, 0x00, 0x0E, 0x10, 0x0E, 0x02, 0x00, 0x0E, 0x10,
+  0x0E, 0x02, 0x00, 0x0F, 0x0E, 0x0F, 0x02, 0x01, 0x10, 0x0A, 0x10, 0x02, 0x01, 0x12, 0x06, 0x12,
+  0x01, 0x02, 0x28, 0x01, 0x02, 0x27, 0x01, 0x03, 0x26, 0x01, 0x04, 0x24, 0x01, 0x04, 0x23, 0x01,
+  0x05, 0x21, 0x01, 0x07, 0x1E, 0x01, 0x08, 0x1B, 0x01, 0x0A, 0x17, 0x01, 0x0C, 0x13, 0x01, 0x0F,
+  0x0D, 0x01, 0x13, 0x0B, 0x01, 0x10, 0x12, 0x01, 0x0E, 0x16, 0x01, 0x0C, 0x19, 0x01, 0x0B, 0x1C,
+  0x01, 0x09, 0x1F, 0x01, 0x08, 0x21, 0x01, 0x07, 0x22, 0x01, 0x07, 0x23, 0x01, 0x06, 0x25, 0x01,
+  0x05, 0x26, 0x02, 0x05, 0x0F, 0x08, 0x0F, 0x02, 0x04, 0x0E, 0x0C, 0x0E, 0x02, 0x04, 0x0D, 0x0E,
+  0x0D, 0x02, 0x03, 0x0D, 0x0F, 0x0D, 0x02, 0x03, 0x0D, 0x10, 0x0C, 0x01, 0x03, 0x0C, 0x01, 0x02,
+  0x0D, 0x01, 0x02, 0x0D, 0x01, 0x02, 0x0C, 0x01, 0x02, 0x0C, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x0D,
+  0x01, 0x01, 0x0D, 0x02, 0x01, 0x0C, 0x0A, 0x07, 0x02, 0x01, 0x0C, 0x06, 0x0F, 0x02, 0x01, 0x0C,
+  0x04, 0x13, 0x02, 0x00, 0x0D, 0x03, 0x16, 0x02, 0x00, 0x0D, 0x02, 0x18, 0x02, 0x00, 0x0D, 0x01,
+  0x1A, 0x01, 0x00, 0x29, 0x01, 0x00, 0x2A, 0x01, 0x00, 0x2A, 0x01, 0x00, 0x2B, 0x02, 0x00, 0x17,
+  0x01, 0x13, 0x02, 0x00, 0x13, 0x09, 0x10, 0x02, 0x00, 0x11, 0x0C, 0x0F, 0x02, 0x00, 0x10, 0x0E,
+  0x0F, 0x02, 0x00, 0x0F, 0x10, 0x0E, 0x02, 0x00, 0x0F, 0x11, 0x0D, 0x02, 0x00, 0x0E, 0x12, 0x0D,
+  0x02, 0x00, 0x0E, 0x13, 0x0C, 0x02, 0x00, 0x0D, 0x14, 0x0D, 0x02, 0x00, 0x0D, 0x14, 0x0D, 0x02,
+  0x00, 0x0D, 0x14, 0x0D, 0x02, 0x00, 0x0D, 0x14, 0x0D, 0x02, 0x01, 0x0C, 0x14, 0x0D, 0x02, 0x01,
+  0x0C, 0x14, 0x0D, 0x02, 0x01, 0x0C, 0x14, 0x0D, 0x02, 0x01, 0x0C, 0x14, 0x0D, 0x02, 0x01, 0x0C,
+  0x14, 0x0C, 0x02, 0x01, 0x0D, 0x12, 0x0D, 0x02, 0x02, 0x0C, 0x12, 0x0D, 0x02, 0x02, 0x0C, 0x12,
+  0x0D, 0x02, 0x02, 0x0D, 0x10, 0x0E, 0x02, 0x03, 0x0D, 0x0E, 0x0E, 0x02, 0x03, 0x0E, 0x0C, 0x0F,
+  0x02, 0x03, 0x0F, 0x0A, 0x10, 0x02, 0x04, 0x10, 0x06, 0x11, 0x01, 0x04, 0x26, 0x01, 0x05, 0x25,
+  0x01, 0x06, 0x23, 0x01, 0x06, 0x22, 0x01, 0x07, 0x21, 0x01, 0x08, 0x1E, 0x01, 0x09, 0x1C, 0x01,
+  0x0B, 0x19, 0x01, 0x0C, 0x16, 0x01, 0x0E, 0x12, 0x01, 0x12, 0x0B, 0x01, 0x00, 0x2F, 0x01, 0x00,
+  0x2F, 0x01, 0x00, 0x2F, 0x01, 0x00, 0x2F, 0x01, 0x00, 0x2F, 0x01, 0x00, 0x2F, 0x01, 0x00, 0x2F,
+  0x01, 0x00, 0x2F, 0x01, 0x00, 0x2F, 0x01, 0x00, 0x2F, 0x01, 0x00, 0x2F, 0x01, 0x00, 0x2E, 0x01,
+  0x21, 0x0C, 0x01, 0x20, 0x0C, 0x01, 0x1F, 0x0D, 0x01, 0x1E, 0x0D, 0x01, 0x1D, 0x0D, 0x01, 0x1D,
+  0x0C, 0x01, 0x1C, 0x0D, 0x01, 0x1B, 0x0D, 0x01, 0x1A, 0x0D, 0x01, 0x1A, 0x0C, 0x01, 0x19, 0x0D,
+  0x01, 0x18, 0x0D, 0x01, 0x18, 0x0D, 0x01, 0x17, 0x0D, 0x01, 0x16, 0x0D, 0x01, 0x16, 0x0D, 0x01,
+  0x15, 0x0D, 0x01, 0x15, 0x0D, 0x01, 0x14, 0x0D, 0x01, 0x14, 0x0C, 0x01, 0x13, 0x0D, 0x01, 0x13,
+  0x0C, 0x01, 0x12, 0x0D, 0x01, 0x12, 0x0C, 0x01, 0x11, 0x0D, 0x01, 0x11, 0x0D, 0x01, 0x10, 0x0D,
+  0x01, 0x10, 0x0D, 0x01, 0x10, 0x0C, 0x01, 0x0F, 0x0D, 0x01, 0x0F, 0x0D, 0x01, 0x0E, 0x0D, 0x01,
+  0x0E, 0x0D, 0x01, 0x0E, 0x0C, 0x01, 0x0E, 0x0C, 0x01, 0x0D, 0x0D, 0x01, 0x0D, 0x0D, 0x01, 0x0D,
+  0x0C, 0x01, 0x0C, 0x0D, 0x01, 0x0C, 0x0D, 0x01, 0x0C, 0x0D, 0x01, 0x0C, 0x0C, 0x01, 0x0C, 0x0C,
+  0x01, 0x0B, 0x0D, 0x01, 0x0B, 0x0D, 0x01, 0x0B, 0x0D, 0x01, 0x0B, 0x0D, 0x01, 0x0B, 0x0C, 0x01,
+  0x0A, 0x0D, 0x01, 0x0A, 0x0D, 0x01, 0x0A, 0x0D, 0x01, 0x0A, 0x0D, 0x01, 0x0A, 0x0D, 0x01, 0x0A,
+  0x0D, 0x01, 0x0A, 0x0D, 0x01, 0x12, 0x0C, 0x01, 0x0F, 0x12, 0x01, 0x0C, 0x17, 0x01, 0x0B, 0x1A,
+  0x01, 0x09, 0x1D, 0x01, 0x08, 0x20, 0x01, 0x07, 0x22, 0x01, 0x06, 0x23, 0x01, 0x05, 0x25, 0x01,
+  0x05, 0x26, 0x01, 0x04, 0x27, 0x02, 0x03, 0x10, 0x09, 0x10, 0x02, 0x03, 0x0E, 0x0D, 0x0E, 0x02,
+  0x03, 0x0D, 0x10, 0x0C, 0x02, 0x03, 0x0C, 0x11, 0x0D, 0x02, 0x02, 0x0D, 0x12, 0x0C, 0x02, 0x02,
+  0x0C, 0x13, 0x0C, 0x02, 0x02, 0x0C, 0x14, 0x0B, 0x02, 0x02, 0x0C, 0x14, 0x0B, 0x02, 0x02, 0x0C,
+  0x14, 0x0B, 0x02, 0x02, 0x0C, 0x14, 0x0B, 0x02, 0x03, 0x0B, 0x13, 0x0C, 0x02, 0x03, 0x0B, 0x13,
+  0x0C, 0x02, 0x03, 0x0C, 0x12, 0x0B, 0x02, 0x04, 0x0C, 0x10, 0x0C, 0x02, 0x04, 0x0D, 0x0E, 0x0C,
+  0x02, 0x05, 0x0D, 0x0C, 0x0D, 0x02, 0x05, 0x0F, 0x08, 0x0E, 0x01, 0x06, 0x23, 0x01, 0x08, 0x20,
+  0x01, 0x09, 0x1E, 0x01, 0x0B, 0x1A, 0x01, 0x0A, 0x1C, 0x01, 0x08, 0x1F, 0x01, 0x07, 0x22, 0x01,
+  0x05, 0x25, 0x01, 0x04, 0x27, 0x02, 0x04, 0x10, 0x07, 0x11, 0x02, 0x03, 0x0F, 0x0C, 0x0E, 0x02,
+  0x02, 0x0E, 0x0F, 0x0E, 0x02, 0x02, 0x0E, 0x10, 0x0E, 0x02, 0x01, 0x0E, 0x12, 0x0D, 0x02, 0x01,
+  0x0D, 0x13, 0x0D, 0x02, 0x01, 0x0D, 0x13, 0x0E, 0x02, 0x00, 0x0E, 0x14, 0x0D, 0x02, 0x00, 0x0D,
+  0x15, 0x0D, 0x02, 0x00, 0x0D, 0x15, 0x0D, 0x02, 0x00, 0x0D, 0x15, 0x0D, 0x02, 0x00, 0x0D, 0x15,
+  0x0D, 0x02, 0x00, 0x0D, 0x15, 0x0D, 0x02, 0x00, 0x0D, 0x15, 0x0D, 0x02, 0x00, 0x0E, 0x14, 0x0D,
+  0x02, 0x00, 0x0E, 0x13, 0x0E, 0x02, 0x00, 0x0E, 0x13, 0x0E, 0x02, 0x01, 0x0E, 0x12, 0x0E, 0x02,
+  0x01, 0x0F, 0x10, 0x0E, 0x02, 0x01, 0x10, 0x0E, 0x0F, 0x02, 0x02, 0x10, 0x0B, 0x11, 0x02, 0x02,
+  0x13, 0x06, 0x12, 0x01, 0x03, 0x2A, 0x01, 0x03, 0x29, 0x01, 0x04, 0x27, 0x01, 0x05, 0x25, 0x01,
+  0x06, 0x23, 0x01, 0x07, 0x21, 0x01, 0x08, 0x1F, 0x01, 0x0A, 0x1C, 0x01, 0x0B, 0x19, 0x01, 0x0E,
+  0x14, 0x01, 0x11, 0x0D, 0x01, 0x11, 0x0A, 0x01, 0x0D, 0x12, 0x01, 0x0B, 0x16, 0x01, 0x09, 0x19,
+  0x01, 0x08, 0x1C, 0x01, 0x07, 0x1E, 0x01, 0x06, 0x20, 0x01, 0x05, 0x22, 0x01, 0x04, 0x23, 0x01,
+  0x03, 0x25, 0x01, 0x03, 0x26, 0x02, 0x02, 0x10, 0x08, 0x0F, 0x02, 0x02, 0x0E, 0x0C, 0x0E, 0x02,
+  0x01, 0x0E, 0x0E, 0x0D, 0x02, 0x01, 0x0D, 0x10, 0x0D, 0x02, 0x01, 0x0D, 0x10, 0x0D, 0x02, 0x00,
+  0x0D, 0x12, 0x0C, 0x02, 0x00, 0x0D, 0x12, 0x0D, 0x02, 0x00, 0x0D, 0x12, 0x0D, 0x02, 0x00, 0x0D,
+  0x13, 0x0C, 0x02, 0x00, 0x0C, 0x14, 0x0C, 0x02, 0x00, 0x0C, 0x14, 0x0D, 0x02, 0x00, 0x0C, 0x14,
+  0x0D, 0x02, 0x00, 0x0C, 0x14, 0x0D, 0x02, 0x00, 0x0C, 0x14, 0x0D, 0x02, 0x00, 0x0C, 0x14, 0x0D,
+  0x02, 0x00, 0x0C, 0x14, 0x0D, 0x02, 0x00, 0x0D, 0x13, 0x0D, 0x02, 0x00, 0x0D, 0x12, 0x0E, 0x02,
+  0x00, 0x0D, 0x12, 0x0E, 0x02, 0x00, 0x0E, 0x10, 0x0F, 0x02, 0x01, 0x0D, 0x10, 0x0F, 0x02, 0x01,
+  0x0E, 0x0E, 0x10, 0x02, 0x01, 0x0F, 0x0C, 0x11, 0x02, 0x02, 0x0F, 0x0A, 0x12, 0x02, 0x02, 0x12,
+  0x03, 0x16, 0x01, 0x03, 0x2A, 0x01, 0x03, 0x2A, 0x01, 0x04, 0x29, 0x01, 0x05, 0x28, 0x01, 0x05,
+  0x28, 0x02, 0x06, 0x19, 0x01, 0x0D, 0x02, 0x07, 0x17, 0x02, 0x0D, 0x02, 0x09, 0x14, 0x03, 0x0D,
+  0x02, 0x0A, 0x12, 0x04, 0x0D, 0x02, 0x0D, 0x0D, 0x06, 0x0D, 0x02, 0x12, 0x03, 0x0B, 0x0C, 0x01,
+  0x20, 0x0C, 0x01, 0x20, 0x0C, 0x01, 0x1F, 0x0D, 0x01, 0x1F, 0x0D, 0x01, 0x1F, 0x0C, 0x02, 0x01,
+  0x0C, 0x11, 0x0D, 0x02, 0x01, 0x0C, 0x11, 0x0D, 0x02, 0x01, 0x0D, 0x0F, 0x0D, 0x02, 0x01, 0x0D,
+  0x0F, 0x0D, 0x02, 0x01, 0x0E, 0x0D, 0x0E, 0x02, 0x01, 0x0F, 0x0B, 0x0E, 0x02, 0x02, 0x10, 0x07,
+  0x10, 0x01, 0x02, 0x26, 0x01, 0x03, 0x25, 0x01, 0x03, 0x24, 0x01, 0x04, 0x22, 0x01, 0x05, 0x20,
+  0x01, 0x06, 0x1E, 0x01, 0x07, 0x1C, 0x01, 0x08, 0x1A, 0x01, 0x0A, 0x16, 0x01, 0x0C, 0x12, 0x01,
+  0x0F, 0x0C, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00,
+  0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E,
+  0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E,
+  0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01,
+  0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E,
+  };
+
+const SpanGlyph FreeSansBold48pt7bSpanGlyphs[] PROGMEM = {
+  {     0,  46,  70,  52,    3,  -67 },   // 0x30 '0'
+  {   306,  30,  67,  52,    6,  -66 },   // 0x31 '1'
+  {   507,  45,  68,  52,    3,  -67 },   // 0x32 '2'
+  {   739,  46,  70,  52,    3,  -67 },   // 0x33 '3'
+  {   993,  47,  67,  52,    2,  -66 },   // 0x34 '4'
+  {  1248,  46,  69,  52,    3,  -66 },   // 0x35 '5'
+  {  1489,  46,  70,  52,    3,  -67 },   // 0x36 '6'
+  {  1771,  47,  67,  52,    3,  -66 },   // 0x37 '7'
+  {  1972,  47,  70,  52,    2,  -67 },   // 0x38 '8'
+  {  2260,  46,  70,  52,    3,  -67 },   // 0x39 '9'
+  {  2546,  14,  49,  31,   11,  -48 },   // 0x3A ':'
+  };
+
+const SpanFont FreeSansBold48pt7bSpans PROGMEM = {
+  FreeSansBold48pt7bSpanData, FreeSansBold48pt7bSpanGlyphs, 0x30, 0x3A, 151 };
@@ -0,0 +1,145 @@
+#include "ambient_light.h"
+
+void AmbientLight::Begin(int pin, const AmbientLightPoint* curve, uint8_t curve_points) {
+  pin_ = pin;
+  curve_ = curve;
+  curve_points_ = curve_points;
+
+#if defined(MCU_IS_ESP32)
+  pinMode(pin_, INPUT);
+  analogReadResolution(kSampleBits);
+#elif defined(MCU_IS_RP2040)
+  // timer callback runs in IRQ, read ADC directly instead of through analogRead's mutex
+  adc_init();
+  adc_gpio_init(pin_);
+#endif
+
+  // start filters settled on first reading, so brightness is right from the start
+  uint16_t raw = Read();
+  for(uint8_t i = 0; i < kMedianSamples; i++)
+    window_[i] = raw;
+  median_raw_ = raw;
+  ema_q8_ = (uint32_t)raw << 8;
+  published_log2_q8_ = Log2Q8(raw);
+  brightness_ = Map(published_log2_q8_);
+  samples_ = 1;
+
+#if defined(MCU_IS_ESP32)
+  esp_timer_create_args_t timer_args = {};
+  timer_args.callback = &SampleTimerCallback;
+  timer_args.arg = this;
+  timer_args.name = "ambient_light";
+  if(esp_timer_create(&timer_args, &sample_timer_) == ESP_OK)
+    esp_timer_start_periodic(sample_timer_, (uint64_t)kSampleMs * 1000);
+#elif defined(MCU_IS_RP2040)
+  add_repeating_timer_ms(kSampleMs, &SampleTimerCallback, this, &sample_timer_);
+#endif
+}
+
+uint16_t AmbientLight::Read() {
+#if defined(MCU_IS_RP2040)
+  adc_select_input(pin_ - 26);
+  return adc_read();
+#else
+  return analogRead(pin_);
+#endif
+}
+
+void AmbientLight::AddSample(uint16_t raw) {
+  window_[window_index_] = raw;
+  window_index_ = (window_index_ + 1) % kMedianSamples;
+
+  // median of window by insertion sort of a copy
+  uint16_t sorted[kMedianSamples];
+  for(uint8_t i = 0; i < kMedianSamples; i++) {
+    uint16_t value = window_[i];
+    int8_t j = i - 1;
+    while(j >= 0 && sorted[j] > value) {
+      sorted[j + 1] = sorted[j];
+      j--;
+    }
+    sorted[j + 1] = value;
+  }
+  uint16_t median = sorted[kMedianSamples / 2];
+  median_raw_ = median;
+
+  // EMA in 1/256 steps of a reading
+  int32_t error = ((int32_t)median << 8) - (int32_t)ema_q8_;
+  ema_q8_ = (uint32_t)((int32_t)ema_q8_ + error / (1 << kEmaShift));
+  samples_++;
+
+  Publish(Log2Q8(filtered_raw()));
+}
+
+// hysteresis in log domain: same relative change of light is needed at any brightness,
+// past the curve ends brightness does not change with reading and needs no hysteresis
+void AmbientLight::Publish(uint16_t log2_q8) {
+  int32_t moved = (int32_t)log2_q8 - (int32_t)published_log2_q8_;
+  bool past_curve_end = (curve_points_ > 0 && (log2_q8 <= Log2Q8(curve_[0].raw) || log2_q8 >= Log2Q8(curve_[curve_points_ - 1].raw)));
+  if(!past_curve_end && moved < kHysteresisLog2 && moved > -(int32_t)kHysteresisLog2)
+    return;
+  published_log2_q8_ = log2_q8;
+  uint8_t brightness = Map(log2_q8);
+  if(brightness != brightness_) {
+    brightness_ = brightness;
+    changes_++;
+  }
+}
+
+// brightness of curve at log2 reading, linear between points in log2 of reading
+uint8_t AmbientLight::Map(uint16_t log2_q8) const {
+  if(curve_points_ == 0)
+    return 0;
+  uint16_t log_lo = Log2Q8(curve_[0].raw);
+  if(log2_q8 <= log_lo)
+    return curve_[0].brightness;
+  for(uint8_t i = 1; i < curve_points_; i++) {
+    uint16_t log_hi = Log2Q8(curve_[i].raw);
+    if(log2_q8 <= log_hi) {
+      if(log_hi == log_lo)
+        return curve_[i].brightness;
+      int32_t b_lo = curve_[i - 1].brightness, b_hi = curve_[i].brightness;
+      return (uint8_t)(b_lo + ((b_hi - b_lo) * (int32_t)(log2_q8 - log_lo) + (log_hi - log_lo) / 2) / (log_hi - log_lo));
+    }
+    log_lo = log_hi;
+  }
+  return curve_[curve_points_ - 1].brightness;
+}
+
+// integer part from highest set bit, each fraction bit from squaring the Q15 mantissa
+uint16_t AmbientLight::Log2Q8(uint16_t x) {
+  if(x == 0)
+    return 0;
+  uint8_t msb = 15;
+  while(!(x & (1 << msb)))
+    msb--;
+  uint32_t y = (uint32_t)x << (15 - msb);   // 1.0 to 2.0 in Q15
+  uint16_t result = msb << 8;
+  for(int8_t bit = 7; bit >= 0; bit--) {
+    y = (y * y) >> 15;
+    if(y >= (2UL << 15)) {
+      y >>= 1;
+      result |= (1 << bit);
+    }
+  }
+  return result;
+}
+
+#if defined(MCU_IS_ESP32)
+
+// runs in esp_timer task
+void AmbientLight::SampleTimerCallback(void* arg) {
+  AmbientLight* ambient_light = (AmbientLight*)arg;
+  ambient_light->AddSample(ambient_light->Read());
+}
+
+#elif defined(MCU_IS_RP2040)
+
+// runs in timer IRQ, returning true keeps timer running
+bool AmbientLight::SampleTimerCallback(struct repeating_timer *t) {
+  AmbientLight* ambient_light = (AmbientLight*)t->user_data;
+  ambient_light->AddSample(ambient_light->Read());
+  return true;
+}
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef AMBIENT_LIGHT_H
+#define AMBIENT_LIGHT_H
+
+#include "common.h"
+#if defined(MCU_IS_ESP32)
+  #include <esp_timer.h>
+#elif defined(MCU_IS_RP2040)
+  #include "pico/stdlib.h"
+  #include "hardware/timer.h"
+  #include "hardware/adc.h"
+#endif
+
+// point of ambient light to display brightness curve, ADC reading of LDR divider and brightness at it
+struct AmbientLightPoint {
+  uint16_t raw;
+  uint8_t brightness;
+};
+
+// Photoresistor light sensing. A timer samples the LDR in the background at kSampleMs, a median
+// of the last kMedianSamples drops spikes and an EMA smooths what is left. The filtered reading
+// maps to a display brightness through a piecewise curve interpolated in log2 of the reading, as
+// the eye and the LDR are both about logarithmic in lux. Brightness is published only when the
+// filtered log reading moves kHysteresisLog2 away from where it was last published, so flicker
+// and slow drift around a curve step do not make the display hunt between two levels.
+class AmbientLight {
+
+public:
+
+  // points are in increasing raw order and are not copied, readings outside them clamp to the ends
+  void Begin(int pin, const AmbientLightPoint* curve, uint8_t curve_points);
+
+  // stable display brightness target for current ambient light
+  uint8_t brightness() const { return brightness_; }
+
+  // last median filtered and EMA filtered readings, for debug output
+  uint16_t median_raw() const { return median_raw_; }
+  uint16_t filtered_raw() const { return (uint16_t)(ema_q8_ >> 8); }
+
+  // samples taken and brightness changes published since Begin
+  uint32_t samples() const { return samples_; }
+  uint32_t changes() const { return changes_; }
+
+  // one sample through the filters, called by sample timer; public so recorded traces can be replayed
+  void AddSample(uint16_t raw);
+
+  // log2 of x in 1/256 steps, 0 for x = 0
+  static uint16_t Log2Q8(uint16_t x);
+
+  constexpr static uint8_t kSampleBits = 12;
+  constexpr static uint16_t kRawMax = (1 << kSampleBits) - 1;
+
+private:
+
+  constexpr static uint16_t kSampleMs = 100;
+  constexpr static uint8_t kMedianSamples = 5;
+  constexpr static uint8_t kEmaShift = 3;         // EMA weight 1/8, about 0.8 s time constant at kSampleMs
+  constexpr static uint16_t kHysteresisLog2 = 64; // a quarter of a doubling of LDR reading
+
+  int pin_ = -1;
+  const AmbientLightPoint* curve_ = NULL;
+  uint8_t curve_points_ = 0;
+  uint8_t Map(uint16_t log2_q8) const;
+
+  // filter state, only touched by sample timer after Begin
+  uint16_t window_[kMedianSamples];
+  uint8_t window_index_ = 0;
+  uint32_t ema_q8_ = 0;
+  uint16_t published_log2_q8_ = 0;
+
+  volatile uint8_t brightness_ = 0;
+  volatile uint16_t median_raw_ = 0;
+  volatile uint32_t samples_ = 0, changes_ = 0;
+
+  uint16_t Read();
+  void Publish(uint16_t log2_q8);
+
+#if defined(MCU_IS_ESP32)
+  esp_timer_handle_t sample_timer_ = NULL;
+  static void SampleTimerCallback(void* arg);
+#elif defined(MCU_IS_RP2040)
+  struct repeating_timer sample_timer_;
+  static bool SampleTimerCallback(struct repeating_timer *t);
+#endif
+
+};
+
+#endif  // AMBIENT_LIGHT_H
@@ -0,0 +1,182 @@
+#include "backlight.h"
+#include <math.h>
+
+#if defined(MCU_IS_ESP32)
+  #define BACKLIGHT_LOCK() xSemaphoreTake(fade_lock_, portMAX_DELAY)
+  #define BACKLIGHT_UNLOCK() xSemaphoreGive(fade_lock_)
+#elif defined(MCU_IS_RP2040)
+  #define BACKLIGHT_LOCK() critical_section_enter_blocking(&fade_lock_)
+  #define BACKLIGHT_UNLOCK() critical_section_exit(&fade_lock_)
+#else
+  #define BACKLIGHT_LOCK()
+  #define BACKLIGHT_UNLOCK()
+#endif
+
+void Backlight::Begin(int pin) {
+  pin_ = pin;
+  for(uint16_t p = 0; p < 256; p++)
+    gamma_lut_[p] = (uint16_t)(powf(p / 255.0f, kGamma) * kDutyMax + 0.5f);
+
+#if defined(MCU_IS_ESP32)
+  #if ESP_ARDUINO_VERSION >= ESP_ARDUINO_VERSION_VAL(3, 0, 0)
+    ledcAttach(pin_, kPwmFrequencyHz, kDutyBits);
+  #endif
+  fade_lock_ = xSemaphoreCreateMutex();
+  esp_timer_create_args_t timer_args = {};
+  timer_args.callback = &FadeTimerCallback;
+  timer_args.arg = this;
+  timer_args.name = "backlight";
+  esp_timer_create(&timer_args, &fade_timer_);
+#elif defined(MCU_IS_RP2040)
+  critical_section_init(&fade_lock_);
+  // set up PWM slice once, so that every write only sets its level and is safe in timer IRQ;
+  // counter wraps after kDutyMax counts, level kDutyMax is always on
+  gpio_set_function(pin_, GPIO_FUNC_PWM);
+  pwm_config config = pwm_get_default_config();
+  pwm_config_set_wrap(&config, kDutyMax - 1);
+  pwm_config_set_clkdiv(&config, (float)clock_get_hz(clk_sys) / ((uint32_t)kDutyMax * kPwmFrequencyHz));
+  pwm_init(pwm_gpio_to_slice_num(pin_), &config, true);
+  pwm_set_gpio_level(pin_, 0);
+#endif
+  energy_millis_ = millis();
+}
+
+void Backlight::SetFade(BacklightFadeCurve curve, uint16_t fade_ms) {
+  curve_ = curve;
+  fade_ms_ = fade_ms;
+}
+
+void Backlight::FadeTo(uint8_t level) {
+  FadeTo(level, curve_, fade_ms_);
+}
+
+// a timer callback already running when the timer is stopped waits on the lock, then steps the new fade
+void Backlight::FadeTo(uint8_t level, BacklightFadeCurve curve, uint16_t fade_ms) {
+  StopTimer();
+  BACKLIGHT_LOCK();
+  AccumulateEnergy();
+  target_level_ = level;
+  start_duty_ = duty_;      // first step fades from where the pin is now
+  target_duty_ = (uint16_t)(((uint32_t)level * kDutyMax + 127) / 255);
+  start_perceived_ = Perceived(start_duty_);
+  target_perceived_ = Perceived(target_duty_);
+  fade_curve_ = curve;
+
+  if(curve == kBacklightFadeInstant || fade_ms == 0 || start_duty_ == target_duty_) {
+    steps_ = 0;
+    step_ = 0;
+    WriteDuty(target_duty_);
+    BACKLIGHT_UNLOCK();
+    return;
+  }
+  steps_ = max(fade_ms / kStepMs, 1);
+  step_ms_ = max(fade_ms / steps_, 1);
+  step_ = 0;
+  BACKLIGHT_UNLOCK();
+  Step();
+  StartTimer();
+}
+
+// duty at end of step, last step ends on target
+uint16_t Backlight::StepDuty(uint16_t step) const {
+  if(step >= steps_)
+    return target_duty_;
+  // fraction of fade done in 1/256
+  uint32_t t = ((uint32_t)step << 8) / steps_;
+  if(fade_curve_ == kBacklightFadeLinear)
+    return start_duty_ + (int32_t)(target_duty_ - start_duty_) * (int32_t)t / 256;
+  if(fade_curve_ == kBacklightFadeEaseInOut)
+    t = (t * t * (3 * 256 - 2 * t)) >> 16;    // smoothstep
+  return gamma_lut_[start_perceived_ + (int16_t)(target_perceived_ - start_perceived_) * (int32_t)t / 256];
+}
+
+// set end duty of next step
+void Backlight::Step() {
+  BACKLIGHT_LOCK();
+  if(step_ < steps_) {
+    step_++;
+    WriteDuty(StepDuty(step_));
+  }
+  BACKLIGHT_UNLOCK();
+}
+
+void Backlight::WriteDuty(uint16_t duty) {
+  AccumulateEnergy();
+#if defined(MCU_IS_ESP32) && ESP_ARDUINO_VERSION >= ESP_ARDUINO_VERSION_VAL(3, 0, 0)
+  ledcWrite(pin_, duty);
+#elif defined(MCU_IS_RP2040)
+  pwm_set_gpio_level(pin_, duty);
+#else
+  analogWrite(pin_, duty);
+#endif
+  duty_ = duty;
+}
+
+// lowest perceived level that gives at least duty
+uint8_t Backlight::Perceived(uint16_t duty) const {
+  uint16_t lo = 0, hi = 255;
+  while(lo < hi) {
+    uint16_t mid = (lo + hi) / 2;
+    if(gamma_lut_[mid] < duty)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+void Backlight::AccumulateEnergy() {
+  unsigned long now = millis();
+  // mW x ms = uJ
+  energy_uj_ += (uint64_t)kMaxPowerMw * duty_ * (now - energy_millis_) / kDutyMax;
+  energy_millis_ = now;
+}
+
+uint32_t Backlight::EnergyMilliJoules() {
+  BACKLIGHT_LOCK();
+  AccumulateEnergy();
+  uint32_t energy_mj = (uint32_t)(energy_uj_ / 1000);
+  BACKLIGHT_UNLOCK();
+  return energy_mj;
+}
+
+#if defined(MCU_IS_ESP32)
+
+// runs in esp_timer task
+void Backlight::FadeTimerCallback(void* arg) {
+  Backlight* backlight = (Backlight*)arg;
+  backlight->Step();
+  if(!backlight->fading())
+    esp_timer_stop(backlight->fade_timer_);
+}
+
+void Backlight::StartTimer() {
+  if(fade_timer_ != NULL)
+    esp_timer_start_periodic(fade_timer_, (uint64_t)step_ms_ * 1000);
+}
+
+void Backlight::StopTimer() {
+  if(fade_timer_ != NULL)
+    esp_timer_stop(fade_timer_);
+}
+
+#elif defined(MCU_IS_RP2040)
+
+// runs in timer IRQ, returning false stops timer
+bool Backlight::FadeTimerCallback(struct repeating_timer *t) {
+  Backlight* backlight = (Backlight*)t->user_data;
+  backlight->Step();
+  return backlight->fading();
+}
+
+void Backlight::StartTimer() {
+  fade_timer_running_ = add_repeating_timer_ms(step_ms_, &FadeTimerCallback, this, &fade_timer_);
+}
+
+void Backlight::StopTimer() {
+  if(fade_timer_running_)
+    cancel_repeating_timer(&fade_timer_);
+  fade_timer_running_ = false;
+}
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef BACKLIGHT_H
+#define BACKLIGHT_H
+
+#include "common.h"
+#if defined(MCU_IS_ESP32)
+  #include <esp_timer.h>
+#elif defined(MCU_IS_RP2040)
+  #include "pico/stdlib.h"
+  #include "hardware/timer.h"
+  #include "hardware/pwm.h"
+  #include "hardware/clocks.h"
+  #include "pico/critical_section.h"
+#endif
+
+// path of brightness from start to target level of a fade
+enum BacklightFadeCurve {
+  kBacklightFadeInstant = 0,
+  kBacklightFadeLinear,         // even steps of PWM duty, to the eye it rushes through the dark end
+  kBacklightFadePerceptual,     // even steps of perceived brightness
+  kBacklightFadeEaseInOut,      // perceived brightness starts and ends slowly
+};
+
+// Display backlight PWM with faded level changes. A level 0 to 255 gives the same duty as
+// analogWrite(level), so brightness constants keep their meaning; fades between levels run along
+// a curve in perceived brightness through a gamma LUT. A timer steps the duty every kStepMs; on
+// ESP32 it writes the LEDC duty register with ledcWrite, which does not wait on the LEDC fade
+// service the way ledcFade can. Callers return at once, nothing runs in loop() during a fade.
+class Backlight {
+
+public:
+
+  void Begin(int pin);
+
+  // curve and time of fades started by FadeTo(level)
+  void SetFade(BacklightFadeCurve curve, uint16_t fade_ms);
+
+  void FadeTo(uint8_t level);
+  void FadeTo(uint8_t level, BacklightFadeCurve curve, uint16_t fade_ms);
+
+  // target level of last fade
+  uint8_t level() const { return target_level_; }
+
+  // PWM duty set at last fade step, of duty_max()
+  uint16_t duty() const { return duty_; }
+  uint16_t duty_max() const { return kDutyMax; }
+  bool fading() const { return step_ < steps_; }
+
+  // estimated backlight energy since Begin, from duty over time at kMaxPowerMw full on
+  uint32_t EnergyMilliJoules();
+
+private:
+
+#if defined(MCU_IS_ESP32) && ESP_ARDUINO_VERSION >= ESP_ARDUINO_VERSION_VAL(3, 0, 0)
+  static const uint8_t kDutyBits = 12;
+  static const uint32_t kPwmFrequencyHz = 5000;
+#else
+  static const uint8_t kDutyBits = 8;       // analogWrite resolution
+  #if defined(MCU_IS_RP2040)
+    static const uint32_t kPwmFrequencyHz = 2000;
+  #endif
+#endif
+  static const uint16_t kDutyMax = (1 << kDutyBits) - 1;
+
+  static const uint16_t kStepMs = 10;       // timer step of a fade
+  constexpr static float kGamma = 2.2;
+  static const uint16_t kMaxPowerMw = 250;  // 2.8" panel LEDs at full duty, for energy estimate
+
+  int pin_ = -1;
+
+  // perceived brightness 0 to 255 to duty
+  uint16_t gamma_lut_[256];
+  uint8_t Perceived(uint16_t duty) const;
+
+  BacklightFadeCurve curve_ = kBacklightFadeEaseInOut;
+  uint16_t fade_ms_ = 0;
+
+  // fade in progress, step k of steps_ ends at StepDuty(k)
+  uint8_t target_level_ = 0;
+  volatile uint16_t duty_ = 0;
+  uint16_t start_duty_ = 0, target_duty_ = 0;
+  uint8_t start_perceived_ = 0, target_perceived_ = 0;
+  BacklightFadeCurve fade_curve_ = kBacklightFadeInstant;
+  volatile uint16_t step_ = 0, steps_ = 0;
+  uint16_t step_ms_ = 0;
+  uint16_t StepDuty(uint16_t step) const;
+  void Step();
+  void WriteDuty(uint16_t duty);
+
+  // energy integral
+  uint64_t energy_uj_ = 0;
+  unsigned long energy_millis_ = 0;
+  void AccumulateEnergy();
+
+  // fade state is shared by FadeTo() and the timer callback, which runs in the esp_timer task
+  // possibly on the other core on ESP32 and in timer IRQ on RP2040
+#if defined(MCU_IS_ESP32)
+  esp_timer_handle_t fade_timer_ = NULL;
+  SemaphoreHandle_t fade_lock_ = NULL;
+  static void FadeTimerCallback(void* arg);
+#elif defined(MCU_IS_RP2040)
+  struct repeating_timer fade_timer_;
+  bool fade_timer_running_ = false;
+  critical_section_t fade_lock_;
+  static bool FadeTimerCallback(struct repeating_timer *t);
+#endif
+  void StartTimer();
+  void StopTimer();
+
+};
+
+#endif  // BACKLIGHT_H
@@ -0,0 +1,255 @@
+#include "canvas_arena.h"
+
+ArenaCanvas1::ArenaCanvas1(uint8_t* buffer, uint32_t capacity_bytes) : Adafruit_GFX(0, 0), buffer_(buffer), capacity_bytes_(capacity_bytes) {}
+
+bool ArenaCanvas1::Resize(uint16_t w, uint16_t h) {
+  if((uint32_t)((w + 7) / 8) * h > capacity_bytes_)
+    return false;
+  WIDTH = _width = w;
+  HEIGHT = _height = h;
+  // reset drawing state a new GFXcanvas1 would have
+  cursor_x = cursor_y = 0;
+  textsize_x = textsize_y = 1;
+  textcolor = textbgcolor = 0xFFFF;
+  wrap = true;
+  gfxFont = NULL;
+  ResetView();
+  return true;
+}
+
+void ArenaCanvas1::SetView(int16_t x, int16_t y, int16_t w, int16_t h) {
+  // clip view to canvas
+  int16_t x2 = min((int16_t)(x + w), WIDTH), y2 = min((int16_t)(y + h), HEIGHT);
+  view_x_ = max(x, (int16_t)0);
+  view_y_ = max(y, (int16_t)0);
+  view_w_ = max((int16_t)(x2 - view_x_), (int16_t)0);
+  view_h_ = max((int16_t)(y2 - view_y_), (int16_t)0);
+  _width = view_w_;
+  _height = view_h_;
+}
+
+void ArenaCanvas1::ResetView() {
+  view_x_ = 0;
+  view_y_ = 0;
+  view_w_ = WIDTH;
+  view_h_ = HEIGHT;
+  _width = WIDTH;
+  _height = HEIGHT;
+}
+
+void ArenaCanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if((x < 0) || (y < 0) || (x >= view_w_) || (y >= view_h_))
+    return;
+  x += view_x_;
+  y += view_y_;
+  uint8_t* ptr = &buffer_[(x >> 3) + y * ((WIDTH + 7) >> 3)];
+  if(color)
+    *ptr |= (0x80 >> (x & 7));
+  else
+    *ptr &= ~(0x80 >> (x & 7));
+}
+
+void ArenaCanvas1::fillScreen(uint16_t color) {
+  if(view_x_ == 0 && view_y_ == 0 && view_w_ == WIDTH && view_h_ == HEIGHT)
+    memset(buffer_, (color ? 0xFF : 0x00), ((WIDTH + 7) >> 3) * HEIGHT);
+  else
+    for(int16_t y = 0; y < view_h_; y++)
+      drawFastHLine(0, y, view_w_, color);
+}
+
+void ArenaCanvas1::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if(w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  if((y < 0) || (y >= view_h_) || (x >= view_w_) || (x + w <= 0))
+    return;
+  if(x < 0) {
+    w += x;
+    x = 0;
+  }
+  if(x + w > view_w_)
+    w = view_w_ - x;
+  x += view_x_;
+  y += view_y_;
+
+  // set or clear whole bytes in the middle, masks at both ends
+  uint8_t* row = &buffer_[y * ((WIDTH + 7) >> 3)];
+  int16_t x_end = x + w;    // exclusive
+  int16_t first_byte = x >> 3, last_byte = (x_end - 1) >> 3;
+  uint8_t first_mask = 0xFF >> (x & 7);
+  uint8_t last_mask = 0xFF << (7 - ((x_end - 1) & 7));
+  if(first_byte == last_byte) {
+    uint8_t mask = first_mask & last_mask;
+    row[first_byte] = (color ? (row[first_byte] | mask) : (row[first_byte] & ~mask));
+    return;
+  }
+  row[first_byte] = (color ? (row[first_byte] | first_mask) : (row[first_byte] & ~first_mask));
+  if(last_byte - first_byte > 1)
+    memset(&row[first_byte + 1], (color ? 0xFF : 0x00), last_byte - first_byte - 1);
+  row[last_byte] = (color ? (row[last_byte] | last_mask) : (row[last_byte] & ~last_mask));
+}
+
+void ArenaCanvas1::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  if(h < 0) {
+    y += h + 1;
+    h = -h;
+  }
+  for(int16_t j = max(y, (int16_t)0); j < min((int16_t)(y + h), view_h_); j++)
+    drawPixel(x, j, color);
+}
+
+bool ArenaCanvas1::getPixel(int16_t x, int16_t y) const {
+  if((x < 0) || (y < 0) || (x >= view_w_) || (y >= view_h_))
+    return false;
+  x += view_x_;
+  y += view_y_;
+  return ((buffer_[(x >> 3) + y * ((WIDTH + 7) >> 3)] >> (7 - (x & 7))) & 0x01);
+}
+
+void ArenaCanvas1::DrawAlignedBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h) {
+  int16_t bitmap_width_bytes = (w + 7) >> 3;
+  if((x < 0) || (x + w > view_w_)) {
+    // partly outside view horizontally, go pixel by pixel
+    for(int16_t j = 0; j < h; j++)
+      for(int16_t i = 0; i < w; i++)
+        if((bitmap[j * bitmap_width_bytes + (i >> 3)] >> (7 - (i & 7))) & 0x01)
+          drawPixel(x + i, y + j, 1);
+    return;
+  }
+  int16_t canvas_x = x + view_x_;
+  uint8_t shift = canvas_x & 7;
+  int16_t last_byte = (canvas_x + w - 1) >> 3;
+  int16_t canvas_width_bytes = (WIDTH + 7) >> 3;
+  for(int16_t j = max((int16_t)0, (int16_t)-y); j < h && y + j < view_h_; j++) {
+    const uint8_t* src = &bitmap[j * bitmap_width_bytes];
+    uint8_t* dst = &buffer_[(y + j + view_y_) * canvas_width_bytes];
+    int16_t idx = canvas_x >> 3;
+    for(int16_t k = 0; k < bitmap_width_bytes; k++, idx++) {
+      dst[idx] |= (src[k] >> shift);
+      if(shift && idx + 1 <= last_byte)
+        dst[idx + 1] |= (src[k] << (8 - shift));
+    }
+  }
+}
+
+PaletteCanvas::PaletteCanvas(uint8_t* buffer, uint32_t capacity_bytes) : Adafruit_GFX(0, 0), buffer_(buffer), capacity_bytes_(capacity_bytes) {}
+
+bool PaletteCanvas::Resize(uint16_t w, uint16_t h, uint8_t bits_per_pixel) {
+  if((bits_per_pixel != 2 && bits_per_pixel != 4) || Bytes(w, h, bits_per_pixel) > capacity_bytes_)
+    return false;
+  bits_per_pixel_ = bits_per_pixel;
+  row_bytes_ = (w * bits_per_pixel + 7) / 8;
+  WIDTH = _width = w;
+  HEIGHT = _height = h;
+  cursor_x = cursor_y = 0;
+  textsize_x = textsize_y = 1;
+  textcolor = textbgcolor = (1 << bits_per_pixel) - 1;
+  wrap = true;
+  gfxFont = NULL;
+  return true;
+}
+
+void PaletteCanvas::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if((x < 0) || (y < 0) || (x >= WIDTH) || (y >= HEIGHT))
+    return;
+  // pixels per byte is 8 / bits_per_pixel_, leftmost pixel in high bits
+  uint8_t* ptr = &buffer_[y * row_bytes_ + ((x * bits_per_pixel_) >> 3)];
+  uint8_t shift = 8 - bits_per_pixel_ - ((x * bits_per_pixel_) & 7);
+  uint8_t mask = ((1 << bits_per_pixel_) - 1) << shift;
+  *ptr = (*ptr & ~mask) | ((color << shift) & mask);
+}
+
+void PaletteCanvas::fillScreen(uint16_t color) {
+  // replicate index over a whole byte
+  uint8_t value = color & ((1 << bits_per_pixel_) - 1);
+  for(uint8_t bits = bits_per_pixel_; bits < 8; bits *= 2)
+    value |= value << bits;
+  memset(buffer_, value, (uint32_t)row_bytes_ * HEIGHT);
+}
+
+void PaletteCanvas::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if(w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  if((y < 0) || (y >= HEIGHT))
+    return;
+  for(int16_t i = max(x, (int16_t)0); i < min((int16_t)(x + w), WIDTH); i++)
+    drawPixel(i, y, color);
+}
+
+uint8_t PaletteCanvas::getPixel(int16_t x, int16_t y) const {
+  if((x < 0) || (y < 0) || (x >= WIDTH) || (y >= HEIGHT))
+    return 0;
+  uint8_t shift = 8 - bits_per_pixel_ - ((x * bits_per_pixel_) & 7);
+  return (buffer_[y * row_bytes_ + ((x * bits_per_pixel_) >> 3)] >> shift) & ((1 << bits_per_pixel_) - 1);
+}
+
+void PaletteCanvas::DrawAlignedBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint8_t index) {
+  DrawAlignedBitmapRamp(x, y, bitmap, w, h, y, 1, index, index);
+}
+
+void PaletteCanvas::DrawAlignedBitmapRamp(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, int16_t ramp_y, int16_t ramp_h, uint8_t first_index, uint8_t last_index) {
+  int16_t bitmap_width_bytes = (w + 7) >> 3;
+  int16_t steps = last_index - first_index;
+  for(int16_t j = max((int16_t)0, (int16_t)-y); j < h && y + j < HEIGHT; j++) {
+    // index of this row, clamped to ramp ends
+    int16_t ramp_row = constrain(y + j - ramp_y, 0, max(ramp_h - 1, 0));
+    uint8_t index = first_index + (ramp_h > 1 ? steps * ramp_row / (ramp_h - 1) : 0);
+    const uint8_t* src = &bitmap[j * bitmap_width_bytes];
+    for(int16_t k = 0; k < bitmap_width_bytes; k++) {
+      if(src[k] == 0)
+        continue;
+      for(uint8_t bit = 0; bit < 8 && (k << 3) + bit < w; bit++)
+        if(src[k] & (0x80 >> bit))
+          drawPixel(x + (k << 3) + bit, y + j, index);
+    }
+  }
+}
+
+ArenaCanvas1* CanvasArena::Acquire(uint16_t w, uint16_t h) {
+  if(!canvas_.Resize(w, h)) {
+    failed_acquire_count_++;
+    PrintLn("CanvasArena::Acquire canvas does not fit: ", (int)(((w + 7) / 8) * h));
+    return NULL;
+  }
+  acquire_count_++;
+  uint32_t bytes = ((w + 7) / 8) * h;
+  if(bytes > peak_bytes_)
+    peak_bytes_ = bytes;
+  canvas_.fillScreen(0);
+  return &canvas_;
+}
+
+PaletteCanvas* CanvasArena::AcquirePalette(uint16_t w, uint16_t h, uint8_t bits_per_pixel) {
+  uint32_t bytes = PaletteCanvas::Bytes(w, h, bits_per_pixel);
+  if(!palette_canvas_.Resize(w, h, bits_per_pixel)) {
+    failed_acquire_count_++;
+    PrintLn("CanvasArena::AcquirePalette canvas does not fit: ", (int)bytes);
+    return NULL;
+  }
+  acquire_count_++;
+  if(bytes > peak_bytes_)
+    peak_bytes_ = bytes;
+  palette_canvas_.fillScreen(0);
+  return &palette_canvas_;
+}
+
+ArenaCanvas1* CanvasArena::AcquireLayer(uint8_t layer, uint16_t w, uint16_t h) {
+  if(layer >= kLayerCount || !layer_canvases_[layer].Resize(w, h)) {
+    failed_acquire_count_++;
+    PrintLn("CanvasArena::AcquireLayer canvas does not fit: ", (int)(((w + 7) / 8) * h));
+    return NULL;
+  }
+  acquire_count_++;
+  uint32_t bytes = (kArenaBytes / 2) * layer + ((w + 7) / 8) * h;
+  if(bytes > peak_bytes_)
+    peak_bytes_ = bytes;
+  layer_canvases_[layer].fillScreen(0);
+  return &layer_canvases_[layer];
+}
+
+void CanvasArena::Release() {
+  canvas_.ResetView();
+}
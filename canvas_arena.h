@@ -0,0 +1,135 @@
+#ifndef CANVAS_ARENA_H
+#define CANVAS_ARENA_H
+
+#include "common.h"
+#include <Adafruit_GFX.h>
+
+// 1-bit drawing surface, same memory layout as GFXcanvas1, but drawing into a buffer it does
+// not own. It never allocates: it is resized in place within the buffer it was handed.
+// A view confines drawing to a sub-rectangle and moves the drawing origin to its top left corner.
+// Rotation is not supported.
+class ArenaCanvas1 : public Adafruit_GFX {
+
+public:
+
+  ArenaCanvas1(uint8_t* buffer, uint32_t capacity_bytes);
+
+  // change canvas size, returns false if w x h does not fit in buffer
+  bool Resize(uint16_t w, uint16_t h);
+
+  // confine drawing to (x, y, w, h) of canvas with origin at (x, y)
+  void SetView(int16_t x, int16_t y, int16_t w, int16_t h);
+  void ResetView();
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  bool getPixel(int16_t x, int16_t y) const;
+
+  // OR a 1-bit bitmap with byte aligned rows onto canvas with top left corner at (x, y)
+  void DrawAlignedBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h);
+
+  uint8_t* getBuffer() const { return buffer_; }
+  uint32_t capacity_bytes() const { return capacity_bytes_; }
+
+private:
+
+  uint8_t* const buffer_;
+  const uint32_t capacity_bytes_;
+
+  // view rectangle in canvas coordinates
+  int16_t view_x_ = 0, view_y_ = 0, view_w_ = 0, view_h_ = 0;
+
+};
+
+// 2 or 4 bits per pixel drawing surface in a buffer it does not own, pixel values are indexes
+// into a palette applied when the canvas is sent to the display. Rows are byte aligned and the
+// leftmost pixel is in the high bits of a byte. Rotation and views are not supported.
+class PaletteCanvas : public Adafruit_GFX {
+
+public:
+
+  PaletteCanvas(uint8_t* buffer, uint32_t capacity_bytes);
+
+  // change canvas size and depth (2 or 4), returns false if it does not fit in buffer
+  bool Resize(uint16_t w, uint16_t h, uint8_t bits_per_pixel);
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  uint8_t getPixel(int16_t x, int16_t y) const;
+
+  // set pixels of a 1-bit bitmap with byte aligned rows at top left corner (x, y) to index
+  void DrawAlignedBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint8_t index);
+
+  // same, index goes linearly from first_index on canvas row ramp_y to last_index on row ramp_y + ramp_h - 1
+  void DrawAlignedBitmapRamp(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, int16_t ramp_y, int16_t ramp_h, uint8_t first_index, uint8_t last_index);
+
+  uint8_t* getBuffer() const { return buffer_; }
+  uint8_t bits_per_pixel() const { return bits_per_pixel_; }
+  static uint32_t Bytes(uint16_t w, uint16_t h, uint8_t bits_per_pixel) { return (uint32_t)((w * bits_per_pixel + 7) / 8) * h; }
+
+private:
+
+  uint8_t* const buffer_;
+  const uint32_t capacity_bytes_;
+  uint8_t bits_per_pixel_ = 4;
+  int16_t row_bytes_ = 0;
+
+};
+
+// Statically allocated memory for the display's canvases, sized for the largest use
+// (a full 1-bit screen, on ESP32-S3 and WROOM also a palette screensaver). Screensaver, time row and incorrect time banner take turns using it,
+// so after boot drawing does not touch the heap.
+class CanvasArena {
+
+public:
+
+  // hand out arena canvas sized w x h with blank content, NULL if it does not fit
+  ArenaCanvas1* Acquire(uint16_t w, uint16_t h);
+
+  // same for a palette canvas, it shares memory with the 1-bit canvas so only one is in use at a time
+  PaletteCanvas* AcquirePalette(uint16_t w, uint16_t h, uint8_t bits_per_pixel);
+
+  // layer canvas sized w x h with blank content in its own part of the arena, NULL if it does not
+  // fit. A layer keeps its contents while the other one is acquired, Acquire and AcquirePalette
+  // overwrite both
+  static const uint8_t kLayerCount = 2;
+  ArenaCanvas1* AcquireLayer(uint8_t layer, uint16_t w, uint16_t h);
+
+  // give canvas back to arena
+  void Release();
+
+  // canvas of last Acquire, its contents stay until next Acquire
+  const ArenaCanvas1* LastCanvas() const { return &canvas_; }
+
+  // instrumentation
+  uint32_t acquire_count_ = 0;
+  uint32_t failed_acquire_count_ = 0;
+  uint32_t peak_bytes_ = 0;
+
+private:
+
+  static const uint32_t k1BitScreenBytes = ((kTftWidth + 7) / 8) * kTftHeight;
+#if defined(MCU_IS_ESP32_S3) || defined(MCU_IS_ESP32_WROOM_DA_MODULE)
+  // also room for a palette canvas of 3/4 of the screen for the gradient screensaver, 4 bits per pixel
+  // up to 320x240 and 2 bits on bigger panels so it stays within 28.8 kB. S2 Mini and RP2040 keep
+  // only the 1-bit screen and draw the screensaver in one color.
+  static const uint8_t kPaletteCanvasBits = ((uint32_t)kTftWidth * kTftHeight <= 320UL * 240 ? 4 : 2);
+  static const uint32_t kPaletteCanvasBytes = (uint32_t)kTftWidth * (kTftHeight * 3 / 4) * kPaletteCanvasBits / 8;
+  static const uint32_t kArenaBytes = (kPaletteCanvasBytes > k1BitScreenBytes ? kPaletteCanvasBytes : k1BitScreenBytes);
+#else
+  static const uint32_t kArenaBytes = k1BitScreenBytes;
+#endif
+
+  static inline uint8_t arena_buffer_[kArenaBytes];
+
+  ArenaCanvas1 canvas_ = ArenaCanvas1(arena_buffer_, kArenaBytes);
+  // arena split in equal parts, one per layer
+  ArenaCanvas1 layer_canvases_[kLayerCount] = {ArenaCanvas1(arena_buffer_, kArenaBytes / 2), ArenaCanvas1(arena_buffer_ + kArenaBytes / 2, kArenaBytes / 2)};
+  PaletteCanvas palette_canvas_ = PaletteCanvas(arena_buffer_, kArenaBytes);
+
+};
+
+#endif  // CANVAS_ARENA_H
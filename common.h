@@ -199,6 +199,14 @@ struct DisplayButton {
   uint16_t btn_w;
   uint16_t btn_h;
   std::string btn_value;
+  // retained drawing state, lets a row whose value or on state changed redraw only its button
+  uint16_t drawn_generation = 0;    // RGBDisplay drawn_rows_generation_ when row was drawn, 0 = never
+  bool drawn_is_on = false;
+  bool label_one_row = true;
+  std::string drawn_value;          // value on display, value_w and value_h are its cached text bounds
+  uint16_t value_w = 0;
+  uint16_t value_h = 0;
+  uint16_t label_w = 0;             // cached text bounds width of row_label, 0 = not measured yet
 };
 
 extern std::vector<std::vector<DisplayButton*>> display_pages_vec;
@@ -222,6 +230,7 @@ extern void AddSecondCoreTaskIfNotThere(SecondCoreTask task);
 extern void WaitForExecutionOfSecondCoreTask();
 extern int AvailableRam();
 extern int MinFreeRam();
+extern int LargestFreeRamBlock();
 extern void SerialInputWait();
 extern void SerialInputFlush();
 extern void SerialTimeStampPrefix();
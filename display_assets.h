@@ -0,0 +1,42 @@
+#ifndef DISPLAY_ASSETS_H
+#define DISPLAY_ASSETS_H
+
+#include "common.h"
+#if defined(MCU_IS_ESP32)
+  #include <pgmspace.h>
+#else
+  #include <avr/pgmspace.h>
+#endif
+
+// Icons and on-screen keyboard layouts. Defined once at namespace scope so they are placed in
+// flash, instead of being copied into RAM as members of the RGBDisplay object.
+// Bitmaps are 1 bit per pixel, MSB first, with byte aligned rows.
+
+// BIG BELL ICONS
+
+const uint8_t kBellWidth = 114, kBellHeight = 75;
+extern const unsigned char kBellBitmap[1125];
+
+const uint8_t kBellFallenWidth = 75, kBellFallenHeight = 71;
+extern const unsigned char kBellFallenBitmap[710];
+
+// SMALL BELL ICONS
+
+const uint8_t kBellSmallWidth = 70, kBellSmallHeight = 46;
+extern const unsigned char kBellSmallBitmap[414];
+
+const uint8_t kBellFallenSmallWidth = 49, kBellFallenSmallHeight = 46;
+extern const unsigned char kBellFallenSmallBitmap[322];
+
+// settings gear icon is kSettingsGearWidth x kSettingsGearHeight
+extern const unsigned char kSettingsGearBitmap[200];
+
+// KEYBOARD
+
+// each row: shift right in 10px steps, key count + 3, key count, then keys
+extern const char Mobile_KB_Capitals[3][13];
+extern const char Mobile_KB_Smalls[3][13];
+extern const char Mobile_NumKeys[3][13];
+extern const char Mobile_SymKeys[3][13];
+
+#endif  // DISPLAY_ASSETS_H
@@ -0,0 +1,231 @@
+#include "display_list.h"
+
+DisplayList::DisplayList() : Adafruit_GFX(kTftWidth, kTftHeight) {}
+
+void DisplayList::Begin(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t bg) {
+  window_x_ = max(x, (int16_t)0);
+  window_y_ = max(y, (int16_t)0);
+  window_w_ = min((int16_t)(x + w), (int16_t)kTftWidth) - window_x_;
+  window_h_ = min((int16_t)(y + h), (int16_t)kTftHeight) - window_y_;
+  bg_ = bg;
+  command_count_ = 0;
+  font_count_ = 0;
+  overflowed_ = false;
+  recorded_count_ = 0;
+  dropped_count_ = 0;
+  culled_count_ = 0;
+}
+
+void DisplayList::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if(!MergePixel(x, y, color))
+    Add(x, y, 1, 1, color, kFillCommand, 0);
+}
+
+// Round rect and circle outlines are drawn a pixel at a time in turns from each corner, so a pixel
+// seldom touches the command just before it. Grow a recent 1 pixel wide run of the same color that
+// the pixel extends, if no command drawn after that run covers the pixel.
+bool DisplayList::MergePixel(int16_t x, int16_t y, uint16_t color) {
+  if(overflowed_ || x < window_x_ || y < window_y_ || x >= window_x_ + window_w_ || y >= window_y_ + window_h_)
+    return false;
+  int16_t oldest = max((int16_t)command_count_ - kPixelMergeLookback, 0);
+  for(int16_t i = command_count_ - 1; i >= oldest; i--) {
+    DisplayListCommand& run = commands_[i];
+    if(run.w == 0)
+      continue;
+    bool covers = (run.x <= x && x < run.x + run.w && run.y <= y && y < run.y + run.h);
+    if(run.font_index == kFillCommand && run.color == color) {
+      if(covers) {
+        recorded_count_++;
+        return true;
+      }
+      if(run.h == 1 && run.y == y && (run.x + run.w == x || x + 1 == run.x)) {
+        run.x = min(run.x, x);
+        run.w++;
+        recorded_count_++;
+        return true;
+      }
+      if(run.w == 1 && run.x == x && (run.y + run.h == y || y + 1 == run.y)) {
+        run.y = min(run.y, y);
+        run.h++;
+        recorded_count_++;
+        return true;
+      }
+    }
+    // pixel would be drawn under this command, earlier runs cannot take it
+    if(covers)
+      return false;
+  }
+  return false;
+}
+
+void DisplayList::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  Add(x, y, w, h, color, kFillCommand, 0);
+}
+
+void DisplayList::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  Add(x, y, w, 1, color, kFillCommand, 0);
+}
+
+void DisplayList::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  Add(x, y, 1, h, color, kFillCommand, 0);
+}
+
+void DisplayList::fillScreen(uint16_t color) {
+  Add(0, 0, WIDTH, HEIGHT, color, kFillCommand, 0);
+}
+
+size_t DisplayList::write(uint8_t c) {
+  // classic font and scaled text are recorded as the rectangles Adafruit_GFX draws them with
+  if(gfxFont == NULL || textsize_x != 1 || textsize_y != 1)
+    return Adafruit_GFX::write(c);
+
+  // same cursor handling as Adafruit_GFX::write(), glyph is recorded instead of drawn
+  if(c == '\n') {
+    cursor_x = 0;
+    cursor_y += gfxFont->yAdvance;
+  }
+  else if(c != '\r' && c >= gfxFont->first && c <= gfxFont->last) {
+    const GFXglyph* glyph = &gfxFont->glyph[c - gfxFont->first];
+    if(glyph->width > 0 && glyph->height > 0) {
+      if(wrap && (cursor_x + glyph->xOffset + glyph->width) > _width) {
+        cursor_x = 0;
+        cursor_y += gfxFont->yAdvance;
+      }
+      uint8_t font_index = FontIndex(gfxFont);
+      if(font_index != kFillCommand)
+        Add(cursor_x + glyph->xOffset, cursor_y + glyph->yOffset, glyph->width, glyph->height, textcolor, font_index, c);
+    }
+    cursor_x += glyph->xAdvance;
+  }
+  return 1;
+}
+
+uint8_t DisplayList::FontIndex(const GFXfont* font) {
+  for(uint8_t i = 0; i < font_count_; i++)
+    if(fonts_[i] == font)
+      return i;
+  if(font_count_ == kMaxFonts) {
+    overflowed_ = true;
+    return kFillCommand;
+  }
+  fonts_[font_count_] = font;
+  return font_count_++;
+}
+
+void DisplayList::Add(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint8_t font_index, char c) {
+  if(w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  if(h < 0) {
+    y += h + 1;
+    h = -h;
+  }
+  if(font_index == kFillCommand) {
+    // clip fills to window, glyphs keep their origin and are clipped when rendered
+    int16_t x2 = min((int16_t)(x + w), (int16_t)(window_x_ + window_w_));
+    int16_t y2 = min((int16_t)(y + h), (int16_t)(window_y_ + window_h_));
+    x = max(x, window_x_);
+    y = max(y, window_y_);
+    w = x2 - x;
+    h = y2 - y;
+  }
+  if(w <= 0 || h <= 0 || overflowed_)
+    return;
+  recorded_count_++;
+  DisplayListCommand command = {x, y, w, h, color, font_index, c};
+
+  // background colored drawing over untouched window changes nothing
+  if(color == bg_ && !IntersectsEarlier(command)) {
+    dropped_count_++;
+    return;
+  }
+
+  // extend previous fill of same color if this one touches it along a whole edge
+  if(font_index == kFillCommand && command_count_ > 0) {
+    DisplayListCommand& last = commands_[command_count_ - 1];
+    if(last.font_index == kFillCommand && last.color == color) {
+      if(last.y == y && last.h == h && (last.x + last.w == x || x + w == last.x)) {
+        last.x = min(last.x, x);
+        last.w += w;
+        return;
+      }
+      if(last.x == x && last.w == w && (last.y + last.h == y || y + h == last.y)) {
+        last.y = min(last.y, y);
+        last.h += h;
+        return;
+      }
+    }
+  }
+
+  if(command_count_ >= command_limit_) {
+    overflowed_ = true;
+    PrintLn("DisplayList::Add command list full");
+    return;
+  }
+  commands_[command_count_++] = command;
+  if(command_count_ > peak_command_count_)
+    peak_command_count_ = command_count_;
+}
+
+bool DisplayList::IntersectsEarlier(const DisplayListCommand& command) const {
+  for(uint16_t i = 0; i < command_count_; i++) {
+    const DisplayListCommand& earlier = commands_[i];
+    if(earlier.w > 0 && earlier.x < command.x + command.w && command.x < earlier.x + earlier.w
+        && earlier.y < command.y + command.h && command.y < earlier.y + earlier.h)
+      return true;
+  }
+  return false;
+}
+
+void DisplayList::Finish() {
+  // a command inside a later fill is fully overdrawn
+  for(uint16_t i = 0; i < command_count_; i++) {
+    DisplayListCommand& command = commands_[i];
+    for(uint16_t j = i + 1; j < command_count_; j++) {
+      const DisplayListCommand& fill = commands_[j];
+      if(fill.font_index == kFillCommand && fill.x <= command.x && command.x + command.w <= fill.x + fill.w
+          && fill.y <= command.y && command.y + command.h <= fill.y + fill.h) {
+        command.w = 0;
+        culled_count_++;
+        break;
+      }
+    }
+  }
+}
+
+void DisplayList::RenderBand(int16_t y, int16_t rows, uint16_t* band) const {
+  for(int32_t i = 0; i < (int32_t)window_w_ * rows; i++)
+    band[i] = bg_;
+
+  int16_t band_y2 = y + rows;
+  int16_t window_x2 = window_x_ + window_w_;
+  for(uint16_t i = 0; i < command_count_; i++) {
+    const DisplayListCommand& command = commands_[i];
+    int16_t y1 = max(command.y, y), y2 = min((int16_t)(command.y + command.h), band_y2);
+    int16_t x1 = max(command.x, window_x_), x2 = min((int16_t)(command.x + command.w), window_x2);
+    if(command.w == 0 || y1 >= y2 || x1 >= x2)
+      continue;
+
+    if(command.font_index == kFillCommand) {
+      for(int16_t yy = y1; yy < y2; yy++) {
+        uint16_t* row = &band[(yy - y) * window_w_];
+        for(int16_t xx = x1; xx < x2; xx++)
+          row[xx - window_x_] = command.color;
+      }
+    }
+    else {
+      // glyph bits are one continuous stream of w x h bits
+      const GFXfont* font = fonts_[command.font_index];
+      const GFXglyph* glyph = &font->glyph[command.c - font->first];
+      const uint8_t* bitmap = &font->bitmap[glyph->bitmapOffset];
+      for(int16_t yy = y1; yy < y2; yy++) {
+        uint16_t* row = &band[(yy - y) * window_w_];
+        uint16_t bit = (yy - command.y) * command.w + (x1 - command.x);
+        for(int16_t xx = x1; xx < x2; xx++, bit++)
+          if(bitmap[bit >> 3] & (0x80 >> (bit & 7)))
+            row[xx - window_x_] = command.color;
+      }
+    }
+  }
+}
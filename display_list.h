@@ -0,0 +1,101 @@
+#ifndef DISPLAY_LIST_H
+#define DISPLAY_LIST_H
+
+#include "common.h"
+#include <Adafruit_GFX.h>
+#include "display_traits.h"
+
+// one recorded primitive: a solid rectangle, or a custom font glyph whose ink box is x, y, w, h
+struct DisplayListCommand {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+  uint16_t color;
+  uint8_t font_index;   // DisplayList::kFillCommand for rectangles
+  char c;
+};
+
+// Retained drawing surface for composing a whole page before it reaches the display.
+// Adafruit_GFX drawing (rects, round rects, lines, text) is recorded as rectangles and glyphs
+// instead of being sent. Commands that change nothing are dropped, touching fills of one color
+// are merged, and commands fully overdrawn by a later fill are culled. The page is then rendered
+// band by band into RGB565 rows and sent to the display as one address window in one transaction.
+// Window of the list starts filled with a background color, so what is recorded must lie within it.
+class DisplayList : public Adafruit_GFX {
+
+public:
+
+  DisplayList();
+
+  // start recording a frame over window (x, y, w, h) cleared to bg
+  void Begin(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t bg);
+
+  // cull overdrawn commands, call once after recording and before rendering bands
+  void Finish();
+
+  // render rows [y, y + rows) of window into band, band is window width wide
+  void RenderBand(int16_t y, int16_t rows, uint16_t* band) const;
+
+  // recording window
+  int16_t window_x() const { return window_x_; }
+  int16_t window_y() const { return window_y_; }
+  int16_t window_w() const { return window_w_; }
+  int16_t window_h() const { return window_h_; }
+
+  // more commands than fit were recorded, frame is incomplete and has to be drawn immediately
+  bool overflowed() const { return overflowed_; }
+
+  // commands a frame may hold, below kMaxCommands only to force an overflow (render benchmark)
+  void LimitCommands(uint16_t limit) { command_limit_ = (limit < kMaxCommands ? limit : kMaxCommands); }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+  size_t write(uint8_t c) override;
+
+  static const uint8_t kFillCommand = 0xFF;
+
+  // rows rendered per band, and buffer a band is rendered into before it is sent. Band buffer
+  // holds about kBandPixels pixels whatever the display width, a narrower display gets more rows.
+  static const uint16_t kBandPixels = 1280;
+  static const uint8_t kBandRows = (kBandPixels / kTftWidth > 0 ? kBandPixels / kTftWidth : 1);
+  static inline uint16_t band_buffer_[kTftWidth * kBandRows];
+
+  // instrumentation of last frame
+  uint16_t recorded_count_ = 0;
+  uint16_t dropped_count_ = 0;
+  uint16_t culled_count_ = 0;
+  // most commands any frame has held since boot, to check kMaxCommands against real pages
+  uint16_t peak_command_count_ = 0;
+
+private:
+
+  void Add(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint8_t font_index, char c);
+  bool IntersectsEarlier(const DisplayListCommand& command) const;
+  bool MergePixel(int16_t x, int16_t y, uint16_t color);
+  uint8_t FontIndex(const GFXfont* font);
+
+  // a settings page row records about 50 commands (label and value glyphs, button fill spans and
+  // outline runs), title and footer take about a row each. A page that does not fit is drawn directly.
+  static const uint16_t kCommandsPerPageRow = 56;
+  static const uint16_t kMaxCommands = (kTftHeight / kPageRowHeight + 1) * kCommandsPerPageRow;
+  static const uint8_t kMaxFonts = 8;
+  static const uint8_t kPixelMergeLookback = 8;   // commands searched for a run a pixel extends
+
+  static inline DisplayListCommand commands_[kMaxCommands];
+  uint16_t command_count_ = 0;
+  uint16_t command_limit_ = kMaxCommands;
+
+  const GFXfont* fonts_[kMaxFonts];
+  uint8_t font_count_ = 0;
+
+  int16_t window_x_ = 0, window_y_ = 0, window_w_ = 0, window_h_ = 0;
+  uint16_t bg_ = 0;
+  bool overflowed_ = false;
+
+};
+
+#endif  // DISPLAY_LIST_H
@@ -0,0 +1,90 @@
+#ifndef DISPLAY_TRAITS_H
+#define DISPLAY_TRAITS_H
+
+#include "common.h"
+
+// compile time properties of each display controller: SPI clock set up by RGBDisplay::Setup(),
+// hardware scroll path, and bytes on the bus for SPI accounting and screensaver span merging
+
+struct ST7789VTraits {
+  static constexpr uint8_t kBytesPerPixel = 2;
+  static constexpr uint32_t kMaxSpiHz = 80000000;
+  static constexpr bool kHardwareScroll = true;     // VSCRDEF / VSCRSADD
+  static constexpr uint8_t kAddrWindowBytes = 11;   // CASET + 4, RASET + 4, RAMWR
+};
+
+struct ST7796Traits {
+  static constexpr uint8_t kBytesPerPixel = 2;
+  static constexpr uint32_t kMaxSpiHz = 40000000;
+  static constexpr bool kHardwareScroll = false;
+  static constexpr uint8_t kAddrWindowBytes = 11;
+};
+
+struct ST7735Traits {
+  static constexpr uint8_t kBytesPerPixel = 2;
+  static constexpr uint32_t kMaxSpiHz = 24000000;
+  static constexpr bool kHardwareScroll = false;
+  static constexpr uint8_t kAddrWindowBytes = 11;
+};
+
+struct ILI9341Traits {
+  static constexpr uint8_t kBytesPerPixel = 2;
+  static constexpr uint32_t kMaxSpiHz = 40000000;
+  static constexpr bool kHardwareScroll = true;
+  static constexpr uint8_t kAddrWindowBytes = 11;
+};
+
+struct ILI9488Traits {
+  static constexpr uint8_t kBytesPerPixel = 3;       // ILI9488_t3 converts RGB565 input to RGB666
+  static constexpr uint32_t kMaxSpiHz = 30000000;
+  static constexpr bool kHardwareScroll = false;
+  static constexpr uint8_t kAddrWindowBytes = 11;
+};
+
+#if defined(DISPLAY_IS_ST7789V)
+  typedef ST7789VTraits DisplayTraits;
+#elif defined(DISPLAY_IS_ST7796)
+  typedef ST7796Traits DisplayTraits;
+#elif defined(DISPLAY_IS_ST7735)
+  typedef ST7735Traits DisplayTraits;
+#elif defined(DISPLAY_IS_ILI9341)
+  typedef ILI9341Traits DisplayTraits;
+#elif defined(DISPLAY_IS_ILI9488)
+  typedef ILI9488Traits DisplayTraits;
+#endif
+
+// sends rows of RGB565 pixels into the current address window, every row is out when Push returns
+// as writePixels blocks on the ESP32 and arduino-pico cores, so one row buffer is enough
+struct DisplayRowPusher {
+  template <class Tft> static void Push(Tft& tft, uint16_t* row, uint32_t len) { tft.writePixels(row, len); }
+};
+
+// controller hardware scroll commands, no-ops when controller has no hardware scroll
+template <bool kHardwareScroll>
+struct HardwareScroller {
+  // whole scroll axis of length lines is scroll area, no fixed areas
+  template <class Tft> static void DefineArea(Tft& tft, uint16_t lines) {
+    uint8_t scroll_area[6] = {0, 0, (uint8_t)(lines >> 8), (uint8_t)(lines & 0xFF), 0, 0};   // TFA, VSA, BFA
+    tft.sendCommand(0x33, scroll_area, 6);    // VSCRDEF
+  }
+  // VSCRSADD parameter is the 2 byte start line (ST7789V and ILI9341 datasheets), a per frame
+  // scroll costs the command byte and these 2 bytes
+  template <class Tft> static void SetStart(Tft& tft, uint16_t start) {
+    uint8_t start_address[2] = {(uint8_t)(start >> 8), (uint8_t)(start & 0xFF)};
+    tft.sendCommand(0x37, start_address, 2);  // VSCRSADD
+  }
+  template <class Tft> static void Stop(Tft& tft) {
+    tft.sendCommand(0x13);                    // NORON, leave scroll mode
+  }
+};
+
+template <>
+struct HardwareScroller<false> {
+  template <class Tft> static void DefineArea(Tft& tft, uint16_t lines) {}
+  template <class Tft> static void SetStart(Tft& tft, uint16_t start) {}
+  template <class Tft> static void Stop(Tft& tft) {}
+};
+
+typedef HardwareScroller<DisplayTraits::kHardwareScroll> DisplayHardwareScroller;
+
+#endif  // DISPLAY_TRAITS_H
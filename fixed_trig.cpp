@@ -0,0 +1,23 @@
+#include "fixed_trig.h"
+
+// quarter wave of sine in Q15, 64 steps from 0 to 90 degrees
+static const int16_t kQuarterSine[65] = {
+      0,   804,  1608,  2410,  3212,  4011,  4808,  5602,  6393,  7179,  7962,  8739,  9512,
+  10278, 11039, 11793, 12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530, 18204, 18868,
+  19519, 20159, 20787, 21403, 22005, 22594, 23170, 23731, 24279, 24811, 25329, 25832, 26319,
+  26790, 27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956, 30273, 30571, 30852, 31113,
+  31356, 31580, 31785, 31971, 32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757, 32767,
+};
+
+int16_t SineQ15(uint16_t angle) {
+  uint8_t quadrant = angle >> 14;
+  uint16_t quarter_angle = angle & 0x3FFF;
+  if(quadrant & 0x01)
+    quarter_angle = 0x4000 - quarter_angle;
+  uint8_t index = quarter_angle >> 8;
+  uint8_t fraction = quarter_angle & 0xFF;
+  int32_t value = kQuarterSine[index];
+  if(fraction)
+    value += ((kQuarterSine[index + 1] - value) * fraction) >> 8;
+  return (quadrant & 0x02 ? -value : value);
+}
@@ -0,0 +1,19 @@
+#ifndef FIXED_TRIG_H
+#define FIXED_TRIG_H
+
+#include "common.h"
+
+// Fixed point trigonometry from a quarter wave table, no floating point.
+// Angles are binary: a full turn is 65536.
+
+// Q15 sine and cosine, linearly interpolated between table steps
+int16_t SineQ15(uint16_t angle);
+inline int16_t CosineQ15(uint16_t angle) { return SineQ15(angle + 0x4000); }
+
+// binary angle of whole degrees, negative and over 360 degrees wrap around
+inline uint16_t DegreesToAngle(int16_t degrees) { return (uint16_t)(((int32_t)degrees * 65536 + (degrees >= 0 ? 180 : -180)) / 360); }
+
+// r times Q15 value, rounded to nearest
+inline int16_t MulQ15(int16_t r, int16_t q15) { return (int16_t)(((int32_t)r * q15 + (1 << 14)) >> 15); }
+
+#endif  // FIXED_TRIG_H
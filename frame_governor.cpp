@@ -0,0 +1,60 @@
+#include "frame_governor.h"
+
+void FrameGovernor::SetTargetFps(uint8_t fps) {
+  target_fps_ = max(fps, (uint8_t)1);
+}
+
+bool FrameGovernor::FrameDue() {
+  unsigned long now = millis(), frame_ms = 1000UL / target_fps_;
+  if(now - frame_millis_ < frame_ms)
+    return false;
+  // keep frames on a steady beat, start over after a stall
+  frame_millis_ = (now - frame_millis_ < 2 * frame_ms ? frame_millis_ + frame_ms : now);
+  return true;
+}
+
+void FrameGovernor::FrameDrawn() {
+  unsigned long now_us = micros();
+  // first stats window starts with first frame, not at boot
+  if(!window_started_) {
+    window_start_us_ = now_us;
+    window_started_ = true;
+  }
+  if(frames_ > 0) {
+    int32_t deviation_us = (int32_t)(now_us - last_frame_us_) - (int32_t)(1000000UL / target_fps_);
+    jitter_us_ = max(jitter_us_, (uint32_t)abs(deviation_us));
+  }
+  last_frame_us_ = now_us;
+  frames_++;
+}
+
+/*! @brief  Sleep until next frame is due. delay() blocks this task in the scheduler, on ESP32
+            that lets the idle task halt the core (and enter automatic light sleep when power
+            management is enabled) until the tick of the next frame.
+*/
+void FrameGovernor::SleepUntilNextFrame(uint16_t max_sleep_ms) {
+  unsigned long frame_ms = 1000UL / target_fps_;
+  unsigned long since_frame_ms = millis() - frame_millis_;
+  if(since_frame_ms >= frame_ms)
+    return;
+  unsigned long sleep_ms = min(frame_ms - since_frame_ms, (unsigned long)max_sleep_ms);
+  unsigned long start_us = micros();
+  delay(sleep_ms);
+  slept_us_ += micros() - start_us;
+}
+
+FrameStats FrameGovernor::TakeStats() {
+  unsigned long now_us = micros();
+  uint32_t window_us = (window_started_ ? now_us - window_start_us_ : 0);
+  FrameStats stats;
+  stats.frames = frames_;
+  stats.target_fps = target_fps_;
+  stats.jitter_us = jitter_us_;
+  stats.idle_percent = (window_us > 0 ? (uint8_t)min((uint64_t)slept_us_ * 100 / window_us, (uint64_t)100) : 0);
+
+  window_start_us_ = now_us;
+  slept_us_ = 0;
+  jitter_us_ = 0;
+  frames_ = 0;
+  return stats;
+}
@@ -0,0 +1,48 @@
+#ifndef FRAME_GOVERNOR_H
+#define FRAME_GOVERNOR_H
+
+#include "common.h"
+
+// achieved frame pacing since last TakeStats()
+struct FrameStats {
+  uint16_t frames;
+  uint16_t target_fps;
+  uint32_t jitter_us;       // largest difference of a frame interval from target interval
+  uint8_t idle_percent;     // time spent sleeping between frames
+};
+
+// Paces frames of an animation at a target frame rate on a steady beat and sleeps the core
+// between them, so a slow animation does not spin loop() and keep the CPU busy.
+class FrameGovernor {
+
+public:
+
+  void SetTargetFps(uint8_t fps);
+  uint8_t target_fps() const { return target_fps_; }
+
+  // true when next frame is due, that frame starts now
+  bool FrameDue();
+
+  // a frame reached the display, counted in stats; frames that were due may be dropped before drawing
+  void FrameDrawn();
+
+  // sleep until next frame is due, at most max_sleep_ms so inputs are still polled
+  void SleepUntilNextFrame(uint16_t max_sleep_ms);
+
+  // stats since last call, then starts a new stats window
+  FrameStats TakeStats();
+
+private:
+
+  uint8_t target_fps_ = 50;
+  unsigned long frame_millis_ = 0;
+
+  // stats window
+  unsigned long window_start_us_ = 0, last_frame_us_ = 0;
+  bool window_started_ = false;
+  uint32_t slept_us_ = 0, jitter_us_ = 0;
+  uint16_t frames_ = 0;
+
+};
+
+#endif  // FRAME_GOVERNOR_H
@@ -7,6 +7,12 @@ const uint32_t kInactivityMillisLimit = 60000;
 // user input delay
 const uint32_t kUserInputDelayMs = 200;
 
+// longest sleep between screensaver frames, buttons are polled at least this often
+const uint16_t kScreensaverMaxSleepMs = 50;
+
+// longest wait of render task for a command before checking queue again
+const uint16_t kRenderTaskWaitMs = 1000;
+
 // watchdog timeout time (RP2040 has a max watchdog timeout time of 8.3 seconds)
 const unsigned long kWatchdogTimeoutMs = 20000;
 const unsigned long kWatchdogTimeoutOtaUpdateMs = 90000;
@@ -0,0 +1,213 @@
+#include "glyph_atlas.h"
+
+GlyphAtlas::GlyphAtlas(const GFXfont* font, const char* charset) {
+  memset(glyph_index_, -1, sizeof(glyph_index_));
+
+  // count glyphs and bitmap bytes
+  uint8_t glyph_count = 0;
+  uint32_t bitmap_bytes = 0;
+  for(const char* c = charset; *c != '\0'; c++) {
+    if((uint8_t)*c >= kMaxChars || *c < font->first || *c > font->last || glyph_index_[(uint8_t)*c] >= 0)
+      continue;
+    const GFXglyph* gfx_glyph = &font->glyph[*c - font->first];
+    glyph_index_[(uint8_t)*c] = glyph_count++;
+    bitmap_bytes += ((gfx_glyph->width + 7) >> 3) * gfx_glyph->height;
+  }
+
+  glyphs_ = new AtlasGlyph[glyph_count];
+  bitmaps_ = new uint8_t[bitmap_bytes];
+  memset(bitmaps_, 0, bitmap_bytes);
+
+  // unpack each glyph from its continuous bit stream into byte aligned rows
+  uint8_t* bitmap_ptr = bitmaps_;
+  for(uint8_t c = 0; c < kMaxChars; c++) {
+    if(glyph_index_[c] < 0)
+      continue;
+    const GFXglyph* gfx_glyph = &font->glyph[c - font->first];
+    AtlasGlyph* glyph = &glyphs_[glyph_index_[c]];
+    glyph->bitmap = bitmap_ptr;
+    glyph->w = gfx_glyph->width;
+    glyph->h = gfx_glyph->height;
+    glyph->x_offset = gfx_glyph->xOffset;
+    glyph->y_offset = gfx_glyph->yOffset;
+    glyph->x_advance = gfx_glyph->xAdvance;
+
+    const uint8_t* src = &font->bitmap[gfx_glyph->bitmapOffset];
+    uint16_t bit = 0;
+    uint8_t bits = 0;
+    int16_t row_bytes = (glyph->w + 7) >> 3;
+    for(int16_t yy = 0; yy < glyph->h; yy++) {
+      for(int16_t xx = 0; xx < glyph->w; xx++) {
+        if(!(bit++ & 7))
+          bits = *src++;
+        if(bits & 0x80)
+          bitmap_ptr[yy * row_bytes + (xx >> 3)] |= (0x80 >> (xx & 7));
+        bits <<= 1;
+      }
+    }
+    bitmap_ptr += row_bytes * glyph->h;
+  }
+}
+
+GlyphAtlas::GlyphAtlas(const SpanFont* font, const char* charset) {
+  memset(glyph_index_, -1, sizeof(glyph_index_));
+
+  // count glyphs and bitmap bytes
+  uint8_t glyph_count = 0;
+  uint32_t bitmap_bytes = 0;
+  for(const char* c = charset; *c != '\0'; c++) {
+    if((uint8_t)*c >= kMaxChars || (uint8_t)*c < font->first || (uint8_t)*c > font->last || glyph_index_[(uint8_t)*c] >= 0)
+      continue;
+    const SpanGlyph* span_glyph = &font->glyph[*c - font->first];
+    glyph_index_[(uint8_t)*c] = glyph_count++;
+    bitmap_bytes += ((span_glyph->w + 7) >> 3) * span_glyph->h;
+  }
+
+  glyphs_ = new AtlasGlyph[glyph_count];
+  bitmaps_ = new uint8_t[bitmap_bytes];
+  memset(bitmaps_, 0, bitmap_bytes);
+
+  // fill each run of a row with whole bytes and masked end bytes
+  uint8_t* bitmap_ptr = bitmaps_;
+  for(uint8_t c = 0; c < kMaxChars; c++) {
+    if(glyph_index_[c] < 0)
+      continue;
+    const SpanGlyph* span_glyph = &font->glyph[c - font->first];
+    AtlasGlyph* glyph = &glyphs_[glyph_index_[c]];
+    glyph->bitmap = bitmap_ptr;
+    glyph->w = span_glyph->w;
+    glyph->h = span_glyph->h;
+    glyph->x_offset = span_glyph->x_offset;
+    glyph->y_offset = span_glyph->y_offset;
+    glyph->x_advance = span_glyph->x_advance;
+
+    const uint8_t* src = &font->data[span_glyph->offset];
+    int16_t row_bytes = (glyph->w + 7) >> 3;
+    for(int16_t yy = 0; yy < glyph->h; yy++) {
+      uint8_t* row = &bitmap_ptr[yy * row_bytes];
+      uint8_t runs = *src++;
+      int16_t x = 0;
+      while(runs--) {
+        x += *src++;
+        int16_t x2 = x + *src++;
+        int16_t b1 = x >> 3, b2 = (x2 - 1) >> 3;
+        uint8_t first_mask = 0xFF >> (x & 7), last_mask = 0xFF << (7 - ((x2 - 1) & 7));
+        if(b1 == b2)
+          row[b1] |= first_mask & last_mask;
+        else {
+          row[b1] |= first_mask;
+          memset(&row[b1 + 1], 0xFF, b2 - b1 - 1);
+          row[b2] |= last_mask;
+        }
+        x = x2;
+      }
+    }
+    bitmap_ptr += row_bytes * glyph->h;
+  }
+}
+
+const AtlasGlyph* GlyphAtlas::Glyph(char c) const {
+  if((uint8_t)c >= kMaxChars || glyph_index_[(uint8_t)c] < 0)
+    return NULL;
+  return &glyphs_[glyph_index_[(uint8_t)c]];
+}
+
+bool GlyphAtlas::Has(char c) const {
+  return Glyph(c) != NULL;
+}
+
+bool GlyphAtlas::HasAll(const char* text) const {
+  for(const char* c = text; *c != '\0'; c++)
+    if(!Has(*c))
+      return false;
+  return true;
+}
+
+void GlyphAtlas::TextBounds(const char* text, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) const {
+  int16_t cursor_x = 0;
+  int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+  for(const char* c = text; *c != '\0'; c++) {
+    const AtlasGlyph* glyph = Glyph(*c);
+    if(glyph == NULL)
+      continue;
+    int16_t gx1 = cursor_x + glyph->x_offset, gy1 = glyph->y_offset;
+    int16_t gx2 = gx1 + glyph->w - 1, gy2 = gy1 + glyph->h - 1;
+    minx = min(minx, gx1);
+    miny = min(miny, gy1);
+    maxx = max(maxx, gx2);
+    maxy = max(maxy, gy2);
+    cursor_x += glyph->x_advance;
+  }
+  *x1 = 0;
+  *y1 = 0;
+  *w = 0;
+  *h = 0;
+  if(maxx >= minx) {
+    *x1 = minx;
+    *w = maxx - minx + 1;
+  }
+  if(maxy >= miny) {
+    *y1 = miny;
+    *h = maxy - miny + 1;
+  }
+}
+
+void GlyphAtlas::LineBounds(int16_t* y1, uint16_t* h) const {
+  int16_t miny = 0x7FFF, maxy = -0x7FFF;
+  for(uint8_t c = 0; c < kMaxChars; c++) {
+    const AtlasGlyph* glyph = Glyph(c);
+    if(glyph == NULL || glyph->h == 0)
+      continue;
+    miny = min(miny, (int16_t)glyph->y_offset);
+    maxy = max(maxy, (int16_t)(glyph->y_offset + glyph->h - 1));
+  }
+  *y1 = 0;
+  *h = 0;
+  if(maxy >= miny) {
+    *y1 = miny;
+    *h = maxy - miny + 1;
+  }
+}
+
+uint8_t GlyphAtlas::CharSpan(char c, int16_t* x1, uint16_t* w) const {
+  const AtlasGlyph* glyph = Glyph(c);
+  *x1 = 0;
+  *w = 0;
+  if(glyph == NULL)
+    return 0;
+  int16_t x2 = glyph->x_advance;
+  if(glyph->w > 0) {
+    *x1 = min((int16_t)0, (int16_t)glyph->x_offset);
+    x2 = max(x2, (int16_t)(glyph->x_offset + glyph->w));
+  }
+  *w = x2 - *x1;
+  return glyph->x_advance;
+}
+
+int16_t GlyphAtlas::Print(ArenaCanvas1* canvas, int16_t x, int16_t y, const char* text) const {
+  for(const char* c = text; *c != '\0'; c++) {
+    const AtlasGlyph* glyph = Glyph(*c);
+    if(glyph == NULL)
+      continue;
+    if(glyph->w > 0 && glyph->h > 0)
+      canvas->DrawAlignedBitmap(x + glyph->x_offset, y + glyph->y_offset, glyph->bitmap, glyph->w, glyph->h);
+    x += glyph->x_advance;
+  }
+  return x;
+}
+
+int16_t GlyphAtlas::PrintRamp(PaletteCanvas* canvas, int16_t x, int16_t y, const char* text, uint8_t first_index, uint8_t last_index) const {
+  // one ramp over the whole line so all glyphs share it
+  int16_t line_y1;
+  uint16_t line_h;
+  LineBounds(&line_y1, &line_h);
+  for(const char* c = text; *c != '\0'; c++) {
+    const AtlasGlyph* glyph = Glyph(*c);
+    if(glyph == NULL)
+      continue;
+    if(glyph->w > 0 && glyph->h > 0)
+      canvas->DrawAlignedBitmapRamp(x + glyph->x_offset, y + glyph->y_offset, glyph->bitmap, glyph->w, glyph->h, y + line_y1, line_h, first_index, last_index);
+    x += glyph->x_advance;
+  }
+  return x;
+}
@@ -0,0 +1,69 @@
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include "common.h"
+#include <Adafruit_GFX.h>
+#include "canvas_arena.h"
+#include "span_font.h"
+
+// one pre-rendered glyph, rows are byte aligned and unused bits at row ends are 0
+struct AtlasGlyph {
+  const uint8_t* bitmap;
+  uint8_t w;
+  uint8_t h;
+  int8_t x_offset;
+  int8_t y_offset;
+  uint8_t x_advance;
+};
+
+// Glyphs of a fixed set of characters of a GFXfont or SpanFont unpacked once at startup into byte aligned
+// 1-bit bitmaps. Text made of these characters is composed into an ArenaCanvas1 with
+// shifted byte ORs, and its bounds come from stored glyph metrics, no Adafruit_GFX text pass.
+// Text positions and bounds match Adafruit_GFX print() / getTextBounds() at text size 1.
+class GlyphAtlas {
+
+public:
+
+  // charset must only contain characters that exist in the font
+  GlyphAtlas(const GFXfont* font, const char* charset);
+
+  // same from a span encoded font, glyph rows are filled run by run
+  GlyphAtlas(const SpanFont* font, const char* charset);
+
+  // character is in atlas
+  bool Has(char c) const;
+
+  // all characters of text are in atlas
+  bool HasAll(const char* text) const;
+
+  // same as Adafruit_GFX getTextBounds(text, 0, 0, x1, y1, w, h) for single line text
+  void TextBounds(const char* text, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) const;
+
+  // vertical extent of all atlas glyphs relative to baseline
+  void LineBounds(int16_t* y1, uint16_t* h) const;
+
+  // horizontal extent of character ink and advance relative to cursor, returns x advance
+  uint8_t CharSpan(char c, int16_t* x1, uint16_t* w) const;
+
+  // draw text with cursor at baseline (x, y), returns cursor x after text
+  int16_t Print(ArenaCanvas1* canvas, int16_t x, int16_t y, const char* text) const;
+
+  // same on a palette canvas, palette index goes from first_index at top of line bounds to last_index at bottom
+  int16_t PrintRamp(PaletteCanvas* canvas, int16_t x, int16_t y, const char* text, uint8_t first_index, uint8_t last_index) const;
+
+private:
+
+  const AtlasGlyph* Glyph(char c) const;
+
+  static const uint8_t kMaxChars = 128;
+
+  // index into glyphs_ of each ascii character, -1 if not in atlas
+  int8_t glyph_index_[kMaxChars];
+
+  // glyphs and all their bitmaps, allocated once at startup
+  AtlasGlyph* glyphs_ = NULL;
+  uint8_t* bitmaps_ = NULL;
+
+};
+
+#endif  // GLYPH_ATLAS_H
@@ -0,0 +1,42 @@
+#include "keyboard_sprites.h"
+#include "canvas_arena.h"
+#if defined(MCU_IS_ESP32)
+  #include <pgmspace.h>
+#else
+  #include <avr/pgmspace.h>
+#endif
+
+void KeyboardSprites::Build(const char layout[][13], uint8_t rows, int16_t y0) {
+  key_count_ = 0;
+  for(uint8_t y = 0; y < rows; y++) {
+    int16_t shift_right = 10 * pgm_read_byte(&(layout[y][0]));
+    uint8_t end_column = pgm_read_byte(&(layout[y][1]));
+    for(uint8_t x = 3; x < min(end_column, (uint8_t)13) && key_count_ < kMaxKeys; x++) {
+      KeyboardKey& key = keys_[key_count_];
+      key = {(int16_t)(8 + kKeyPitchX * (x - 3) + shift_right), (int16_t)(y0 + kKeyPitchY * y), (char)pgm_read_byte(&(layout[y][x]))};
+
+      // label in default font at size 2, at the place MakeKeyboard used to print it
+      ArenaCanvas1 face(faces_[key_count_], kFaceBytes);
+      face.Resize(kFaceW, kFaceH);
+      face.fillScreen(0);
+      face.setTextSize(2);
+      face.setCursor(4 - kFaceOffset, 5 - kFaceOffset);
+      face.print(key.label);
+      key_count_++;
+    }
+  }
+}
+
+int8_t KeyboardSprites::KeyAt(int16_t x, int16_t y) const {
+  for(uint8_t i = 0; i < key_count_; i++)
+    if(x >= keys_[i].x && x <= keys_[i].x + kKeyW && y >= keys_[i].y && y <= keys_[i].y + kKeyH)
+      return i;
+  return -1;
+}
+
+int8_t KeyboardSprites::KeyAtSamePlace(const KeyboardKey& other) const {
+  for(uint8_t i = 0; i < key_count_; i++)
+    if(keys_[i].x == other.x && keys_[i].y == other.y)
+      return i;
+  return -1;
+}
@@ -0,0 +1,63 @@
+#ifndef KEYBOARD_SPRITES_H
+#define KEYBOARD_SPRITES_H
+
+#include "common.h"
+
+// one character key of on screen keyboard, top left corner of its button and its label
+struct KeyboardKey {
+  int16_t x;
+  int16_t y;
+  char label;
+};
+
+// keys other than characters, at same place on every layout
+enum KeyboardSpecialKey {
+  kKeyboardShift = 0,
+  kKeyboardNumpad,
+  kKeyboardSpace,
+  kKeyboardDelete,
+  kKeyboardEnter,
+  kKeyboardBack,
+  kKeyboardSpecialKeyCount
+};
+
+// Character keys of one on screen keyboard layout with their faces pre-rendered as 1-bit
+// sprites: the label on the inside of the button, sent with one small blit. Keys of two
+// layouts are diffed so that a layout change only repaints keys that moved or changed label.
+class KeyboardSprites {
+
+public:
+
+  // character key button, face sprite is the part of its inside clear of rounded corners
+  static const int16_t kKeyW = 20, kKeyH = 25;
+  static const int16_t kKeyPitchX = 23, kKeyPitchY = 30;
+  static const int16_t kFaceOffset = 2, kFaceW = 16, kFaceH = 21;
+  static const uint8_t kMaxKeys = 30;
+
+  /*! @brief  Lay out keys of layout table rows and render their faces. A table row is
+              {right shift in 10 px, end column, key count, labels...} in PROGMEM.
+      @param  y0  top of first key row
+  */
+  void Build(const char layout[][13], uint8_t rows, int16_t y0);
+
+  uint8_t key_count() const { return key_count_; }
+  const KeyboardKey& key(uint8_t index) const { return keys_[index]; }
+  const uint8_t* face(uint8_t index) const { return faces_[index]; }
+
+  // index of key whose button contains (x, y), -1 if none
+  int8_t KeyAt(int16_t x, int16_t y) const;
+
+  // index of key with button at same place as key of other layout, -1 if none
+  int8_t KeyAtSamePlace(const KeyboardKey& other) const;
+
+private:
+
+  static const uint16_t kFaceBytes = ((kFaceW + 7) / 8) * kFaceH;
+
+  KeyboardKey keys_[kMaxKeys];
+  uint8_t faces_[kMaxKeys][kFaceBytes];
+  uint8_t key_count_ = 0;
+
+};
+
+#endif  // KEYBOARD_SPRITES_H
@@ -101,6 +101,7 @@ Touchscreen* ts = NULL;         // Touchscreen class object
 
 #if defined(ESP32_DUAL_CORE)
   TaskHandle_t Task1;
+  TaskHandle_t RenderTask;
 #endif
 
 // Arduino SPI Class Object
@@ -221,6 +222,7 @@ void setup() {
   display = new RGBDisplay();
   // setup and populate display
   display->Setup();
+  display->render_queue_.Begin();
   if(nvs_preferences->RetrieveIsTouchscreen())
     ts = new Touchscreen();
 
@@ -269,13 +271,22 @@ void setup() {
         0,  /* Priority of the task */
         &Task1,  /* Task handle. */
         0); /* Core where the task should run */
+    // render task draws queued commands on the other core than loop(). It shares core 0 with the
+    // wifi task at a higher priority, so drawing preempts wifi work; both take the display lock
+    // for display state, see RenderQueue
+    xTaskCreatePinnedToCore(
+        RenderTaskCode, /* Function to implement the task */
+        "RenderTask", /* Name of the task */
+        10000,  /* Stack size in words */
+        NULL,  /* Task input parameter */
+        1,  /* Priority of the task */
+        &RenderTask,  /* Task handle. */
+        0); /* Core where the task should run */
   #endif
 
   ResetWatchdog();
 }
 
-uint8_t frames_per_second = 0;
-
 // arduino loop function on core0 - High Priority one with time update tasks
 void loop() {
   // note if button pressed or touchscreen touched
@@ -289,8 +300,14 @@ void loop() {
   else
     digitalWrite(LED_PIN, LOW);
 
+  // touchscreen shares SPI bus with display, read it between render commands
+  display->render_queue_.Lock();
+  bool ts_touched = (ts != NULL && ts->IsTouched());
+  display->render_queue_.Unlock();
+
   // if a button or touchscreen is pressed then take action
-  if((inactivity_millis >= kUserInputDelayMs) && (push_button_pressed || inc_button_pressed || dec_button_pressed || (ts != NULL && ts->IsTouched()))) {
+  if((inactivity_millis >= kUserInputDelayMs) && (push_button_pressed || inc_button_pressed || dec_button_pressed || ts_touched)) {
+    display->render_queue_.Lock();
     bool ts_input = (ts != NULL && ts->IsTouched());
     // show instant response by turing up brightness
     display->SetMaxBrightness();
@@ -336,11 +353,13 @@ void loop() {
 
     // show firmware updated info only for the first time user uses the device
     firmware_updated_flag_user_information = false;
+    display->render_queue_.Unlock();
   }
 
   // new second! Update Time!
   if (rtc->rtc_hw_sec_update_) {
     rtc->rtc_hw_sec_update_ = false;
+    display->render_queue_.Lock();
 
     // if time is lost because of power failure
     if((rtc->year() < 2024) && !(wifi_stuff->incorrect_wifi_details_) && !(wifi_stuff->incorrect_zip_code)) {
@@ -355,6 +374,24 @@ void loop() {
       rtc->rtc_hw_min_update_ = false;
 
       // PrintLn("New Minute!");
+
+      // heap fragmentation check, steady state canvas drawing should not allocate
+      if(debug_mode) {
+        PrintLn("Largest Free RAM Block: ", LargestFreeRamBlock());
+        PrintLn("Canvas arena acquires: ", (int)display->canvas_arena_.acquire_count_);
+        PrintLn("Canvas arena failed acquires: ", (int)display->canvas_arena_.failed_acquire_count_);
+        PrintLn("Canvas arena peak bytes: ", (int)display->canvas_arena_.peak_bytes_);
+        RenderQueueStats queue_stats = display->render_queue_.TakeStats();
+        PrintLn("Render queue depth: ", queue_stats.depth);
+        PrintLn("Render queue max depth: ", queue_stats.max_depth);
+        PrintLn("Render commands drawn: ", queue_stats.executed);
+        PrintLn("Render commands coalesced: ", queue_stats.coalesced);
+        PrintLn("Render dropped frames: ", queue_stats.dropped_frames);
+        PrintLn("Render latency avg (us): ", (int)queue_stats.avg_latency_us);
+        PrintLn("Render latency max (us): ", (int)queue_stats.max_latency_us);
+        PrintLn("Backlight duty: ", (int)display->backlight_.duty());
+        PrintLn("Backlight energy (mJ): ", (int)display->backlight_.EnergyMilliJoules());
+      }
       // Serial.print("CPU"); Serial.print(xPortGetCoreID()); Serial.print(" "); Serial.println(getCpuFrequencyMhz());
 
       // Activate Buzzer if Alarm Time has arrived
@@ -422,7 +459,7 @@ void loop() {
 
     // update time on main page
     if(current_page == kMainPage)
-      display->DisplayTimeUpdate();
+      display->render_queue_.Push(kRenderTimeUpdate);
 
     // serial print RTC Date Time
     // SerialPrintRtcDateTime();
@@ -476,27 +513,51 @@ void loop() {
     ResetWatchdog();
 
     // print fps
-    if(debug_mode && current_page == kScreensaverPage) {
-      // Serial.printf("FPS: %d\n", frames_per_second);
-      PrintLn("FPS: ", frames_per_second);
-      frames_per_second = 0;
+    if(current_page == kScreensaverPage) {
+      FrameStats frame_stats = display->screensaver_governor_.TakeStats();
+      if(debug_mode) {
+        PrintLn("FPS: ", frame_stats.frames);
+        PrintLn("Target FPS: ", frame_stats.target_fps);
+        PrintLn("Frame jitter (us): ", (int)frame_stats.jitter_us);
+        PrintLn("CPU idle %: ", frame_stats.idle_percent);
+        if(frame_stats.frames > 0) {
+          PrintLn("FastDrawTwoColorBitmapSpi us/frame: ", display->fast_draw_micros_ / frame_stats.frames);
+          PrintLn("Display pixels/frame: ", (int)(display->render_stats_.pixels / frame_stats.frames));
+          PrintLn("Display address windows/frame: ", (int)(display->render_stats_.addr_windows / frame_stats.frames));
+          PrintLn("Display SPI bytes/frame: ", (int)(display->render_stats_.bytes / frame_stats.frames));
+        }
+        display->fast_draw_micros_ = 0;
+        display->render_stats_ = {0, 0, 0};
+      }
     }
+    display->render_queue_.Unlock();
   }
 
-  // make screensaver motion fast
-  if(current_page == kScreensaverPage) {
-    display->Screensaver();
-    if(debug_mode) frames_per_second++;
+  // screensaver frames at the frame rate cap of current brightness, motion speed is set in px/s
+  if(current_page == kScreensaverPage && display->ScreensaverFrameDue()) {
+    display->render_queue_.Push(kRenderScreensaverFrame);
   }
 
   // accept user serial inputs
-  if (Serial.available() != 0)
+  if (Serial.available() != 0) {
+    display->render_queue_.Lock();
     ProcessSerialInput();
+    display->render_queue_.Unlock();
+  }
+
+  #if !defined(ESP32_DUAL_CORE)
+    // no render task, draw queued commands here
+    display->ProcessRenderQueue();
+  #endif
 
   #if defined(MCU_IS_ESP32_S2_MINI)
     // ESP32_S2_MINI is single core MCU
     loop1();
   #endif
+
+  // sleep between screensaver frames instead of spinning, short enough to keep buttons responsive
+  if(current_page == kScreensaverPage && Serial.available() == 0)
+    display->screensaver_governor_.SleepUntilNextFrame(kScreensaverMaxSleepMs);
 }
 
 #if defined(MCU_IS_RP2040)
@@ -550,8 +611,11 @@ void loop1() {
         success = wifi_stuff->GetTimeFromNtpServer();
         PrintLn("loop1(): wifi_stuff->GetTimeFromNtpServer() success = ", success);
       }
-      if(success)
+      if(success) {
+        display->render_queue_.Lock();
         display->redraw_display_ = true;
+        display->render_queue_.Unlock();
+      }
     }
     else if(current_task == kConnectWiFi) {
       wifi_stuff->TurnWiFiOn();
@@ -606,6 +670,13 @@ void Task1code( void * parameter) {
   for(;;) 
     loop1();
 }
+
+// render task, sleeps until loop() queues drawing
+void RenderTaskCode( void * parameter) {
+  for(;;)
+    if(display->render_queue_.WaitForCommand(kRenderTaskWaitMs))
+      display->ProcessRenderQueue();
+}
 #endif
 
 void WaitForExecutionOfSecondCoreTask() {
@@ -613,13 +684,27 @@ void WaitForExecutionOfSecondCoreTask() {
     // ESP32_S2_MINI is single core MCU
     loop1();
   #elif defined(MCU_IS_RP2040) || defined(ESP32_DUAL_CORE)
+    // loop1() takes the display lock to flag a redraw, do not hold it meanwhile
+    uint8_t display_lock_depth = display->render_queue_.UnlockAll();
     unsigned long time_start = millis();
     while (!second_core_tasks_queue.empty() && millis() - time_start <  kWatchdogTimeoutMs - 2000) {
       delay(10);
     }
+    display->render_queue_.Relock(display_lock_depth);
   #endif
 }
 
+// delay after a user input without holding the display, so queued feedback is drawn meanwhile:
+// by the render task, or right here when there is none
+void DelayWithoutDisplay(unsigned long delay_ms) {
+  uint8_t display_lock_depth = display->render_queue_.UnlockAll();
+  #if !defined(ESP32_DUAL_CORE)
+    display->ProcessRenderQueue();
+  #endif
+  delay(delay_ms);
+  display->render_queue_.Relock(display_lock_depth);
+}
+
 // initialize RGB LED requires NVS Preferences to be loaded
 void InitializeRgbLed() {
   if(rgb_led_strip != NULL) {
@@ -730,6 +815,16 @@ int MinFreeRam() {
   return esp_get_minimum_free_heap_size();
 }
 
+// largest block that can be allocated, falls behind free RAM as heap fragments
+int LargestFreeRamBlock() {
+  #if defined(MCU_IS_RP2040)
+    return rp2040.getFreeHeap();
+  #elif defined(MCU_IS_ESP32)
+    // https://docs.espressif.com/projects/esp-idf/en/stable/esp32/api-reference/system/mem_alloc.html
+    return heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  #endif
+}
+
 void SerialInputWait() {
   while (Serial.available() == 0) // delay until something is received via serial
     delay(20);
@@ -1162,15 +1257,37 @@ void ProcessSerialInput() {
         SerialInputFlush();
         display->screensaver_bounce_not_fly_horizontally_ = (userInput == 0 ? false : true);
         Serial.printf("fly_screensaver_horizontally_ = %d\n", display->screensaver_bounce_not_fly_horizontally_);
+        Serial.println(F("Lissajous Drift? (0/1):"));
+        SerialInputWait();
+        userInput = Serial.parseInt();
+        SerialInputFlush();
+        display->screensaver_lissajous_ = (userInput == 0 ? false : true);
+        Serial.printf("screensaver_lissajous_ = %d\n", display->screensaver_lissajous_);
         Serial.println(F("Colored Border? (0/1):"));
         SerialInputWait();
         userInput = Serial.parseInt();
         SerialInputFlush();
         display->show_colored_edge_screensaver_ = (userInput == 0 ? false : true);
         Serial.printf("show_colored_edge_screensaver_ = %d\n", display->show_colored_edge_screensaver_);
+        Serial.println(F("Gradient Colors? (0/1):"));
+        SerialInputWait();
+        userInput = Serial.parseInt();
+        SerialInputFlush();
+        display->screensaver_gradient_ = (userInput == 0 ? false : true);
+        Serial.printf("screensaver_gradient_ = %d\n", display->screensaver_gradient_);
         display->refresh_screensaver_canvas_ = true;
       }
       break;
+    case 'D':   // dump last composed display canvas
+      Serial.println(F("**** Display Canvas PBM ****"));
+      display->DumpCanvasPbm();
+      Serial.printf("Render stats since last reset: pixels %u, address windows %u, bytes %u\n", display->render_stats_.pixels, display->render_stats_.addr_windows, display->render_stats_.bytes);
+      break;
+    case 'B':   // render benchmark
+      Serial.println(F("**** Render Benchmark ****"));
+      display->RunRenderBenchmark();
+      SetPage(kMainPage);
+      break;
     default:
       Serial.println(F("Unrecognized user input"));
   }
@@ -1248,6 +1365,13 @@ void SetPage(ScreenPage set_this_page, bool move_cursor_to_first_button) {
 }
 
 void SetPage(ScreenPage set_this_page, bool move_cursor_to_first_button, bool increment_page) {
+  // leaving screensaver, undo its hardware scrolling before any other page is drawn
+  if(current_page == kScreensaverPage && set_this_page != kScreensaverPage)
+    display->ResetHardwareScroll();
+  // new page is drawn from scratch, no row of the previous page is on display
+  display->InvalidateDrawnRows();
+  // a queued page redraw draws its cursor when it runs
+  bool page_queued = false;
   switch(set_this_page) {
     case kMainPage:
       // if screensaver is active then clear screensaver canvas to free memory
@@ -1255,8 +1379,8 @@ void SetPage(ScreenPage set_this_page, bool move_cursor_to_first_button, bool in
         display->ScreensaverControl(false);
       current_page = set_this_page;         // new page needs to be set before any action
       if(move_cursor_to_first_button) current_cursor = kCursorNoSelection;
-      display->redraw_display_ = true;
-      display->DisplayTimeUpdate();
+      display->render_queue_.Push(kRenderPage);
+      page_queued = true;
       // useful flag to show on UI the latest firmware in Settings Page
       wifi_stuff->firmware_update_available_str_ = "";
       break;
@@ -1290,14 +1414,16 @@ void SetPage(ScreenPage set_this_page, bool move_cursor_to_first_button, bool in
       // show page
       current_page = set_this_page;     // new page needs to be set before any action
       if(move_cursor_to_first_button) current_cursor = kWiFiSettingsPageScanNetworks;
-      display->DisplayCurrentPage();
+      display->render_queue_.Push(kRenderPage);
+      page_queued = true;
       break;
     case kSettingsPage:
     case kLocationAndWeatherSettingsPage:
     case kScreensaverSettingsPage:
       current_page = set_this_page;     // new page needs to be set before any action
       if(move_cursor_to_first_button) current_cursor = display_pages_vec[current_page][0]->btn_cursor_id;
-      display->DisplayCurrentPage();
+      display->render_queue_.Push(kRenderPage);
+      page_queued = true;
       break;
     case kWiFiScanNetworksPage:
       current_page = set_this_page;     // new page needs to be set before any action
@@ -1355,8 +1481,9 @@ void SetPage(ScreenPage set_this_page, bool move_cursor_to_first_button, bool in
     default:
       Serial.print("Unprogrammed Page "); Serial.print(set_this_page); Serial.println('!');
   }
-  delay(kUserInputDelayMs);
-  display->DisplayCursorHighlight(/*highlight_On = */ true);
+  DelayWithoutDisplay(kUserInputDelayMs);
+  if(!page_queued)
+    display->DisplayCursorHighlight(/*highlight_On = */ true);
 }
 
 void MoveCursor(bool increment) {
@@ -1444,9 +1571,10 @@ void MoveCursor(bool increment) {
   }
   PrintLn("current_cursor = ", current_cursor);
 
+  // cursor is button feedback, draw it now rather than behind queued drawing
   display->DisplayCursorHighlight(/*highlight_On = */ true);
   // wait a little
-  delay(2*kUserInputDelayMs);
+  DelayWithoutDisplay(2*kUserInputDelayMs);
 }
 
 // populate all pages in display_pages_vec
@@ -1559,7 +1687,7 @@ int DisplayPagesVecButtonIndex(ScreenPage button_page, Cursor button_cursor) {
 
 void LedOnOffResponse() {
   digitalWrite(LED_PIN, HIGH);
-  delay(kUserInputDelayMs);
+  DelayWithoutDisplay(kUserInputDelayMs);
   digitalWrite(LED_PIN, LOW);
 }
 
@@ -1572,7 +1700,7 @@ void LedButtonClickUiResponse(int response_type = 0) {
   switch (response_type) {
     case 1:   // turn On Button, wait
       display->DisplayCurrentPageButtonRow(/*is_on = */ true);
-      delay(kUserInputDelayMs);
+      DelayWithoutDisplay(kUserInputDelayMs);
       break;
     case 2:   // turn On Button
       display->DisplayCurrentPageButtonRow(/*is_on = */ true);
@@ -1582,7 +1710,7 @@ void LedButtonClickUiResponse(int response_type = 0) {
       break;
     default:     // turn On Button, wait, turn Off button
       display->DisplayCurrentPageButtonRow(/*is_on = */ true);
-      delay(kUserInputDelayMs);
+      DelayWithoutDisplay(kUserInputDelayMs);
       display->DisplayCurrentPageButtonRow(/*is_on = */ false);
   }
 }
@@ -0,0 +1,143 @@
+#include "render_queue.h"
+
+#if defined(ESP32_DUAL_CORE)
+  #define RENDER_QUEUE_LOCK() xSemaphoreTake(queue_lock_, portMAX_DELAY)
+  #define RENDER_QUEUE_UNLOCK() xSemaphoreGive(queue_lock_)
+#else
+  #define RENDER_QUEUE_LOCK()
+  #define RENDER_QUEUE_UNLOCK()
+#endif
+
+void RenderQueue::Begin() {
+#if defined(ESP32_DUAL_CORE)
+  display_lock_ = xSemaphoreCreateRecursiveMutex();
+  queue_lock_ = xSemaphoreCreateMutex();
+  command_pushed_ = xSemaphoreCreateBinary();
+#endif
+}
+
+void RenderQueue::Push(RenderCommand command) {
+  RENDER_QUEUE_LOCK();
+  if(command == kRenderPage) {
+    // page redraw draws time too
+    if(pending_[kRenderTimeUpdate]) {
+      Remove(kRenderTimeUpdate);
+      coalesced_++;
+    }
+  }
+  if(pending_[command]) {
+    if(command == kRenderScreensaverFrame)
+      dropped_frames_++;
+    else
+      coalesced_++;
+  }
+  else {
+    queue_[count_++] = command;
+    pending_[command] = true;
+    queued_us_[command] = micros();
+    max_depth_ = max(max_depth_, count_);
+  }
+  RENDER_QUEUE_UNLOCK();
+#if defined(ESP32_DUAL_CORE)
+  xSemaphoreGive(command_pushed_);
+#endif
+}
+
+bool RenderQueue::Pop(RenderCommand* command, unsigned long* queued_us) {
+  RENDER_QUEUE_LOCK();
+  bool popped = (count_ > 0);
+  if(popped) {
+    *command = queue_[0];
+    *queued_us = queued_us_[*command];
+    Remove(*command);
+  }
+  RENDER_QUEUE_UNLOCK();
+  return popped;
+}
+
+// take pending command out of queue, keeping order of the others
+void RenderQueue::Remove(RenderCommand command) {
+  uint8_t j = 0;
+  for(uint8_t i = 0; i < count_; i++)
+    if(queue_[i] != command)
+      queue_[j++] = queue_[i];
+  count_ = j;
+  pending_[command] = false;
+}
+
+void RenderQueue::Done(unsigned long queued_us) {
+  uint32_t latency_us = micros() - queued_us;
+  RENDER_QUEUE_LOCK();
+  executed_++;
+  total_latency_us_ += latency_us;
+  max_latency_us_ = max(max_latency_us_, latency_us);
+  RENDER_QUEUE_UNLOCK();
+}
+
+bool RenderQueue::WaitForCommand(uint16_t max_wait_ms) {
+#if defined(ESP32_DUAL_CORE)
+  if(depth() == 0)
+    xSemaphoreTake(command_pushed_, pdMS_TO_TICKS(max_wait_ms));
+#endif
+  return (depth() > 0);
+}
+
+void RenderQueue::Lock() {
+#if defined(ESP32_DUAL_CORE)
+  xSemaphoreTakeRecursive(display_lock_, portMAX_DELAY);
+  display_lock_depth_++;
+#endif
+}
+
+void RenderQueue::Unlock() {
+#if defined(ESP32_DUAL_CORE)
+  display_lock_depth_--;
+  xSemaphoreGiveRecursive(display_lock_);
+#endif
+}
+
+uint8_t RenderQueue::UnlockAll() {
+#if defined(ESP32_DUAL_CORE)
+  if(xSemaphoreGetMutexHolder(display_lock_) != xTaskGetCurrentTaskHandle())
+    return 0;
+  uint8_t depth = display_lock_depth_;
+  for(uint8_t i = 0; i < depth; i++)
+    Unlock();
+  return depth;
+#else
+  return 0;
+#endif
+}
+
+void RenderQueue::Relock(uint8_t depth) {
+  for(uint8_t i = 0; i < depth; i++)
+    Lock();
+}
+
+uint8_t RenderQueue::depth() {
+  RENDER_QUEUE_LOCK();
+  uint8_t depth = count_;
+  RENDER_QUEUE_UNLOCK();
+  return depth;
+}
+
+RenderQueueStats RenderQueue::TakeStats() {
+  RENDER_QUEUE_LOCK();
+  RenderQueueStats stats;
+  stats.depth = count_;
+  stats.max_depth = max_depth_;
+  stats.executed = executed_;
+  stats.coalesced = coalesced_;
+  stats.dropped_frames = dropped_frames_;
+  stats.avg_latency_us = (executed_ > 0 ? total_latency_us_ / executed_ : 0);
+  stats.max_latency_us = max_latency_us_;
+
+  max_depth_ = count_;
+  executed_ = 0;
+  coalesced_ = 0;
+  dropped_frames_ = 0;
+  total_latency_us_ = 0;
+  max_latency_us_ = 0;
+  RENDER_QUEUE_UNLOCK();
+  return stats;
+}
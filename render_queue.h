@@ -0,0 +1,85 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include "common.h"
+
+// drawing work loop() hands over to the render task
+enum RenderCommand {
+  kRenderPage = 0,            // redraw current page and its cursor
+  kRenderTimeUpdate,          // main page time update
+  kRenderScreensaverFrame,
+  kRenderCommandCount         // needs to be last entry in the enum
+};
+
+// render queue metrics since last TakeStats()
+struct RenderQueueStats {
+  uint8_t depth;              // commands pending now
+  uint8_t max_depth;
+  uint16_t executed;
+  uint16_t coalesced;         // page and time update commands merged into a pending one
+  uint16_t dropped_frames;    // screensaver frames merged into a pending frame
+  uint32_t avg_latency_us;    // from first push of a command to end of its drawing
+  uint32_t max_latency_us;
+};
+
+// Bounded FIFO of render commands between loop() and the render task. A command that is already
+// pending is not queued again, it draws the latest state when it runs, so superseded time updates
+// and frames are dropped. A page redraw also supersedes a pending time update. The cursor is
+// button feedback and is drawn directly by loop(), not queued.
+// Lock() guards the display: the render task holds it from popping a command to the end of its
+// drawing, and loop() and loop1() hold it while they draw directly or change state the commands
+// draw from: current_page, current_cursor, the page and keyboard state and the redraw_display_ and
+// screensaver flags of RGBDisplay. Lock and wait are no-ops without a render task.
+class RenderQueue {
+
+public:
+
+  // create locks, before render task starts
+  void Begin();
+
+  void Push(RenderCommand command);
+
+  // oldest pending command and micros() of its first push, false if queue is empty
+  bool Pop(RenderCommand* command, unsigned long* queued_us);
+
+  // command popped at queued_us is drawn
+  void Done(unsigned long queued_us);
+
+  // sleep until a command is pushed, at most max_wait_ms, returns true if queue is not empty
+  bool WaitForCommand(uint16_t max_wait_ms);
+
+  void Lock();
+  void Unlock();
+
+  // give the display up entirely if calling task holds it, as while waiting on a delay, returns
+  // its lock depth for Relock(); 0 and no-op if caller does not hold it or there is no render task
+  uint8_t UnlockAll();
+  void Relock(uint8_t depth);
+
+  uint8_t depth();
+  RenderQueueStats TakeStats();
+
+private:
+
+  RenderCommand queue_[kRenderCommandCount];
+  uint8_t count_ = 0;
+  bool pending_[kRenderCommandCount] = {};
+  unsigned long queued_us_[kRenderCommandCount] = {};
+
+  // stats window
+  uint8_t max_depth_ = 0;
+  uint16_t executed_ = 0, coalesced_ = 0, dropped_frames_ = 0;
+  uint32_t total_latency_us_ = 0, max_latency_us_ = 0;
+
+  void Remove(RenderCommand command);
+
+#if defined(ESP32_DUAL_CORE)
+  SemaphoreHandle_t display_lock_ = NULL;   // recursive, loop() draws from nested calls
+  uint8_t display_lock_depth_ = 0;          // changed only by task holding display_lock_
+  SemaphoreHandle_t queue_lock_ = NULL;
+  SemaphoreHandle_t command_pushed_ = NULL;
+#endif
+
+};
+
+#endif  // RENDER_QUEUE_H
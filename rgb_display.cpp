@@ -9,13 +9,14 @@ void RGBDisplay::Setup() {
   /* INITIALIZE DISPLAYS */
 
   // tft display backlight control PWM output pin
-  pinMode(TFT_BL, OUTPUT);
+  backlight_.Begin(TFT_BL);
+  backlight_.SetFade(kBacklightFadeEaseInOut, kBacklightDimFadeMs);
 
 #if defined(DISPLAY_IS_ST7789V)
 
   // OR use this initializer (uncomment) if using a 2.0" 320x240 TFT:
   // tft.init(TFT_HEIGHT, TFT_WIDTH);           // Init ST7789 320x240
-  uint32_t SPI_Speed = 80000000;
+  uint32_t SPI_Speed = DisplayTraits::kMaxSpiHz;
   tft.init(kTftHeight, kTftWidth);           // Init ST7789 320x240
   tft.setSPISpeed(SPI_Speed);
   tft.invertDisplay(false);
@@ -25,6 +26,7 @@ void RGBDisplay::Setup() {
 #elif defined(DISPLAY_IS_ST7796)
 
   tft.init();           // Init ST7796 480x320
+  tft.setSPISpeed(DisplayTraits::kMaxSpiHz);
   // make display landscape orientation
   tft.setRotation(1);
   screen_orientation_ = nvs_preferences->RetrieveScreenOrientation();
@@ -36,19 +38,21 @@ void RGBDisplay::Setup() {
   tft.initR(INITR_BLACKTAB);  // Init ST7735 chip, black tab
   // set col and row offset of display for ST7735S
   tft.setColRowStart(2, 1);
+  tft.setSPISpeed(DisplayTraits::kMaxSpiHz);
   // make display landscape orientation
   tft.setRotation(1);
 
 #elif defined(DISPLAY_IS_ILI9341)
 
   // Use this initializer if using a 1.8" ILI9341 TFT screen:
-  tft.begin();
+  tft.begin(DisplayTraits::kMaxSpiHz);
   // make display landscape orientation
-  tft.setRotation(1);
+  screen_orientation_ = 1;
+  tft.setRotation(screen_orientation_);
 
 #elif defined(DISPLAY_IS_ILI9488)
 
-  tft.begin();
+  tft.begin(DisplayTraits::kMaxSpiHz);
   tft.setRotation(tft.getRotation() + 2);
   int16_t x, y;
   tft.getOrigin(&x, &y);
@@ -60,10 +64,9 @@ void RGBDisplay::Setup() {
 
 #endif
 
-  // SPI speed defaults to SPI_DEFAULT_FREQ defined in the library, you can override it here
+  // SPI speed is DisplayTraits::kMaxSpiHz of the controller, set in its branch above
   // Note that speed allowable depends on chip and quality of wiring, if you go too fast, you
-  // may end up with a black screen some times, or all the time.
-  // tft.setSPISpeed(80000000);
+  // may end up with a black screen some times, or all the time. Lower kMaxSpiHz in display_traits.h then.
 
   // clear screen
   tft.fillScreen(kDisplayColorBlack);
@@ -77,9 +80,8 @@ void RGBDisplay::Setup() {
   Serial.printf("night_time_minutes: %d minutes  use_photoresistor = %d\n", night_time_minutes, use_photoresistor);
 
   if(use_photoresistor) {
-    // configure Photoresistor pin
-    pinMode(PHOTORESISTOR_PIN, INPUT);
-    analogReadResolution(kAdcResolutionBits);
+    // start sampling photoresistor in background
+    ambient_light_.Begin(PHOTORESISTOR_PIN, kAmbientLightCurve, sizeof(kAmbientLightCurve) / sizeof(kAmbientLightCurve[0]));
 
     // set display brightness
     CheckPhotoresistorAndSetBrightness();
@@ -100,42 +102,39 @@ void RGBDisplay::RotateScreen() {
   tft.setRotation(screen_orientation_);
 }
 
-// set display brightness function
+// set display brightness function, backlight fades to it in the background
 void RGBDisplay::SetBrightness(int brightness) {
   if(current_brightness_ != brightness) {
-    analogWrite(TFT_BL, brightness);
+    // a fade to it may already be started, as by SetMaxBrightness()
+    if(backlight_.level() != brightness)
+      backlight_.FadeTo(brightness);
     if(debug_mode)
       PrintLn("Display Brightness set to ", brightness);
   }
   // if(debug_mode)
   //   RealTimeOnScreenOutput(std::to_string(brightness), 50);
   current_brightness_ = brightness;
-  if(use_photoresistor) {
-    // hysteresis in background color on / off
-    if(!show_colored_edge_screensaver_ && brightness >= kBrightnessBackgroundColorThreshold + 5)
-      show_colored_edge_screensaver_ = true;
-    else if(show_colored_edge_screensaver_ && brightness <= kBrightnessBackgroundColorThreshold - 5)
-      show_colored_edge_screensaver_ = false;
-  }
-  else
-    show_colored_edge_screensaver_ = (brightness >= kEveningBrightness);
+  // ambient light brightness only changes past its own hysteresis, so a plain threshold does not flicker
+  show_colored_edge_screensaver_ = (brightness >= (use_photoresistor ? kBrightnessBackgroundColorThreshold : kEveningBrightness));
 }
 
 void RGBDisplay::SetMaxBrightness() {
-  if(current_brightness_ != kMaxBrightness)
+  if(current_brightness_ != kMaxBrightness) {
+    // fast fade on user input, then the usual brightness bookkeeping
+    backlight_.FadeTo(kMaxBrightness, kBacklightFadePerceptual, kBacklightWakeFadeMs);
     SetBrightness(kMaxBrightness);
+  }
 }
 
 void RGBDisplay::CheckPhotoresistorAndSetBrightness() {
-  int photodiode_light_raw = analogRead(PHOTORESISTOR_PIN);
-  // int lcd_brightness_val = max(photodiode_light_raw * kBrightnessInactiveMax / kPhotodiodeLightRawMax, 1);
-  int lcd_brightness_val2 = max((int)map(photodiode_light_raw, 0.2 / 3.3 * kPhotodiodeLightRawMax, kPhotodiodeLightRawMax, kNightBrightness, kBrightnessInactiveMax), kNightBrightness);
+  // filtered and hysteresis stable brightness of ambient light, sampled in background
+  int lcd_brightness_val2 = max((int)ambient_light_.brightness(), kNightBrightness);
   if(rgb_led_strip_on)
     lcd_brightness_val2 = max(lcd_brightness_val2, kRgbStripOnDispMinBrightness);
   else if(rtc->todays_minutes < night_time_minutes && rtc->todays_minutes >= kDayTimeMinutes)
     lcd_brightness_val2 = max(lcd_brightness_val2, kNonNightMinBrightness);
   if(debug_mode)
-    Serial.printf("photodiode_light_raw = %d, lcd_brightness_val2 = %d\n", photodiode_light_raw, lcd_brightness_val2);
+    Serial.printf("photodiode_light median = %d, filtered = %d, lcd_brightness_val2 = %d\n", ambient_light_.median_raw(), ambient_light_.filtered_raw(), lcd_brightness_val2);
   SetBrightness(lcd_brightness_val2);
 }
 
@@ -158,18 +157,140 @@ void RGBDisplay::CheckTimeAndSetBrightness() {
   }
 }
 
+/*!
+    @brief  Draw all pending render commands, each one under display lock so that loop() can
+            take the display between them. The lock is taken before popping, so page state
+            cannot change between picking a command and drawing it.
+*/
+void RGBDisplay::ProcessRenderQueue() {
+  RenderCommand command;
+  unsigned long queued_us;
+  for(;;) {
+    render_queue_.Lock();
+    if(!render_queue_.Pop(&command, &queued_us)) {
+      render_queue_.Unlock();
+      break;
+    }
+    ExecuteRenderCommand(command);
+    // fps counts frames drawn, not frames due, a due frame may be merged into a pending one
+    if(command == kRenderScreensaverFrame && current_page == kScreensaverPage)
+      screensaver_governor_.FrameDrawn();
+    render_queue_.Unlock();
+    render_queue_.Done(queued_us);
+  }
+}
+
+// commands draw state as it is when they run, a command for a page that is no longer shown does nothing
+void RGBDisplay::ExecuteRenderCommand(RenderCommand command) {
+  switch(command) {
+    case kRenderPage:
+      if(current_page == kMainPage) {
+        redraw_display_ = true;
+        DisplayTimeUpdate();
+      }
+      else if(current_page == kSettingsPage || current_page == kWiFiSettingsPage || current_page == kLocationAndWeatherSettingsPage || current_page == kScreensaverSettingsPage)
+        DisplayCurrentPage();
+      else
+        break;
+      DisplayCursorHighlight(/* highlight_On = */ true);
+      break;
+    case kRenderTimeUpdate:
+      if(current_page == kMainPage)
+        DisplayTimeUpdate();
+      break;
+    case kRenderScreensaverFrame:
+      if(current_page == kScreensaverPage)
+        Screensaver();
+      break;
+    default:
+      break;
+  }
+}
+
 void RGBDisplay::ScreensaverControl(bool turnOn) {
-  if(!turnOn && my_canvas_ != NULL) {
-    // delete screensaverCanvas;
-    delete my_canvas_;
+  if(!turnOn && (my_canvas_ != NULL || palette_canvas_ != NULL)) {
+    // release screensaver canvas
+    canvas_arena_.Release();
     my_canvas_ = NULL;
+    palette_canvas_ = NULL;
   }
   else
     refresh_screensaver_canvas_ = true;
+  if(turnOn)
+    StartHardwareScroll();
+  else
+    ResetHardwareScroll();
   // clear screen
   tft.fillScreen(kDisplayColorBlack);
   screensaver_x1_ = 0;
   screensaver_y1_ = 20;
+  // screensaver speed button sets cpu speed, 80, 160 and 240 MHz move 20, 40 and 60 px/s
+  screensaver_motion_.SetSpeed(cpu_speed_mhz / 4);
+  screensaver_motion_.Reset(screensaver_x1_, screensaver_y1_);
+  screensaver_step_millis_ = millis();
+  screensaver_drawn_ = false;
+  // arena is used by other pages in between, sprites have to be rendered again
+  screensaver_sprites_.ClearSprites();
+  screensaver_time_sprite_text_[0] = '\0';
+  screensaver_date_sprite_drawn_ = false;
   redraw_display_ = true;
   PrepareTimeDayDateArrays();
 }
+
+bool RGBDisplay::ScreensaverFrameDue() {
+  screensaver_governor_.SetTargetFps(ScreensaverTargetFps());
+  return screensaver_governor_.FrameDue();
+}
+
+// screensaver frame rate: the dimmer the display the fewer frames, night time is always at night
+// frame rate and lowest cpu speed is a power saving mode with at most evening frame rate
+uint8_t RGBDisplay::ScreensaverTargetFps() {
+  bool night_time = (rtc->year() >= 2024 && (rtc->todays_minutes >= night_time_minutes || rtc->todays_minutes < kDayTimeMinutes));
+  uint8_t fps = kScreensaverDayFps;
+  if(night_time || current_brightness_ <= kNonNightMinBrightness)
+    fps = kScreensaverNightFps;
+  else if(current_brightness_ < kEveningBrightness)
+    fps = kScreensaverEveningFps;
+  if(cpu_speed_mhz <= 80)
+    fps = min(fps, kScreensaverEveningFps);
+  return fps;
+}
+
+// define whole screen width as hardware scroll area, no fixed areas
+void RGBDisplay::StartHardwareScroll() {
+  if(!SupportsHardwareScroll())
+    return;
+  DisplayHardwareScroller::DefineArea(tft, kTftWidth);
+  hardware_scroll_on_ = true;
+  hardware_scroll_start_ = kTftWidth;   // invalid start, forces scroll start to be sent
+  SetHardwareScroll(0);
+}
+
+// scroll frame memory so that frame memory x = 0 shows at screen x = screen_x
+void RGBDisplay::SetHardwareScroll(int16_t screen_x) {
+  if(!SupportsHardwareScroll() || !hardware_scroll_on_)
+    return;
+  // screen_x = frame_x + sign * scroll start, sign depends on MADCTL row order of the rotation set
+  // on the controller
+  #if defined(DISPLAY_IS_ST7789V)
+    int16_t sign = (tft.getRotation() == 1 ? 1 : -1);
+  #else
+    int16_t sign = (tft.getRotation() == 1 ? -1 : 1);
+  #endif
+  uint16_t scroll_start = ((sign * screen_x) % (int16_t)kTftWidth + kTftWidth) % kTftWidth;
+  if(scroll_start == hardware_scroll_start_)
+    return;
+  hardware_scroll_start_ = scroll_start;
+  DisplayHardwareScroller::SetStart(tft, scroll_start);
+  render_stats_.bytes += 3;
+}
+
+// back to normal unscrolled display, needed before any other page is drawn
+void RGBDisplay::ResetHardwareScroll() {
+  if(!SupportsHardwareScroll() || !hardware_scroll_on_)
+    return;
+  hardware_scroll_start_ = kTftWidth;   // invalid start, forces scroll start to be sent
+  SetHardwareScroll(0);
+  DisplayHardwareScroller::Stop(tft);
+  hardware_scroll_on_ = false;
+}
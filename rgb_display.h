@@ -3,6 +3,18 @@
 
 #include "common.h"
 #include <Adafruit_GFX.h>     // Core graphics library
+#include "canvas_arena.h"
+#include "glyph_atlas.h"
+#include "display_traits.h"
+#include "display_list.h"
+#include "display_assets.h"
+#include "screensaver_motion.h"
+#include "frame_governor.h"
+#include "sprite_compositor.h"
+#include "keyboard_sprites.h"
+#include "render_queue.h"
+#include "backlight.h"
+#include "ambient_light.h"
 #if defined(DISPLAY_IS_ST7789V)
   #include <Adafruit_ST7789.h> // Hardware-specific library for ST7789
 #elif defined(DISPLAY_IS_ST7796)
@@ -14,12 +26,15 @@
 #elif defined(DISPLAY_IS_ILI9488)
   #include "ILI9488_t3.h"   // Teensy Hardware DMA accelerated library
 #endif
-#include "Fonts/ComingSoon_Regular70pt7b_numbers_only.h"   // from https://fonts.google.com/ and converted using https://rop.nl/truetype2gfx/ and reduced in size
-#include "Fonts/FreeSansBold48pt7b_numbers_only.h"         // from https://rop.nl/truetype2gfx/ and reduced in size
+// Fonts/*_subset.h and Fonts/*_spans.h are generated by tools/subset_fonts.py from the full font headers
+// for the characters the firmware draws with them, see tools/font_subsets.txt
+#include "Fonts/ComingSoon_Regular70pt7b_spans.h"   // from https://fonts.google.com/ and converted using https://rop.nl/truetype2gfx/
+#include "Fonts/FreeSansBold48pt7b_spans.h"         // from https://rop.nl/truetype2gfx/
+#include "Fonts/FreeSansBold48pt7b_subset.h"        // from https://rop.nl/truetype2gfx/, only for drawing time without canvas
 #include "Fonts/Satisfy_Regular24pt7b.h"     // from https://fonts.google.com/ and converted using https://rop.nl/truetype2gfx/
-#include "Fonts/FreeSansBold24pt7b.h"       // from Adafruit_GFX library
-#include "Fonts/FreeSans24pt7b.h"           // from Adafruit_GFX library
-#include "Fonts/FreeSans18pt7b.h"           // from Adafruit_GFX library
+#include "Fonts/FreeSansBold24pt7b_subset.h"  // from Adafruit_GFX library
+#include "Fonts/FreeSans24pt7b_subset.h"      // from Adafruit_GFX library
+#include "Fonts/FreeSans18pt7b_subset.h"      // from Adafruit_GFX library
 #include "Fonts/Satisfy_Regular18pt7b.h"     // from https://fonts.google.com/ and converted using https://rop.nl/truetype2gfx/
 #include "Fonts/FreeSansBold12pt7b.h"       // from Adafruit_GFX library
 #include "Fonts/FreeSans12pt7b.h"           // from Adafruit_GFX library
@@ -33,6 +48,22 @@
 #endif
 
 
+// counts of what blits sent to display, read and reset by debug reports
+struct RenderStats {
+  uint32_t pixels;
+  uint32_t addr_windows;
+  uint32_t bytes;
+};
+
+// screen rectangle of one character of main page time row, for per character redraw
+struct TimeRowCell {
+  char c;
+  int16_t x;
+  int16_t y;
+  uint16_t w;
+  uint16_t h;
+};
+
 class RGBDisplay {
 
 public:
@@ -41,7 +72,10 @@ public:
 
   // screens
   void DisplayTimeUpdate();
-  void Screensaver();
+  // step_ms 0 moves screensaver by time since its last move, benchmark passes a fixed frame time
+  void Screensaver(uint16_t step_ms = 0);
+  // true when next screensaver frame is due at the frame rate of current brightness, time and cpu speed
+  bool ScreensaverFrameDue();
   void GoodMorningScreen();
   void SetAlarmScreen(bool process_user_input, bool inc_button_pressed, bool dec_button_pressed, bool push_button_pressed);
   void AlarmTriggeredScreen(bool first_time, int8_t button_press_seconds_counter);
@@ -55,6 +89,7 @@ public:
   void FirmwareUpdatePage();
   void RealTimeOnScreenOutput(std::string text, int width);
   void DisplayCurrentPage();
+  void InvalidateDrawnRows();
   void DisplayCurrentPageButtonRow(bool is_on);
   void DisplayCurrentPageButtonRow(int button_index, bool is_on);
   void DisplayCurrentPageButtonRow(DisplayButton* button, int button_index, bool is_on);
@@ -72,6 +107,13 @@ public:
   void CheckPhotoresistorAndSetBrightness();
   void CheckTimeAndSetBrightness();
   void ScreensaverControl(bool turnOn);
+
+  // display controller can scroll frame memory in hardware (VSCRDEF / VSCRSADD). Panels are mounted
+  // in landscape so the controller's vertical scroll axis is the screen's horizontal axis.
+  static constexpr bool SupportsHardwareScroll() { return DisplayTraits::kHardwareScroll; }
+  void StartHardwareScroll();
+  void SetHardwareScroll(int16_t screen_x);
+  void ResetHardwareScroll();
   void RotateScreen();
 
 // PUBLIC VARIABLES / CONSTANTS
@@ -109,6 +151,48 @@ public:
   constexpr static uint8_t kColorPickerWheelSize = 33;
   const uint16_t kColorPickerWheel[kColorPickerWheelSize] = {0x6D9D, 0x867E, 0x897B, 0x065F, 0xF7BB, 0xDD0D, 0xF52C, 0x07FF, 0x46F9, 0xCC53, 0x67E0, 0x0653, 0x07E0, 0xAFE6, 0xF81F, 0xF897, 0xFE76, 0xFCCC, 0xFC60, 0xFBE0, 0xFA69, 0xFAF9, 0xFBBF, 0xB81F, 0x991D, 0xF840, 0xF800, 0xFB09, 0xFFFD, 0x7FE0, 0xFEE0, 0xFFE0, 0xBFE0};
   bool screensaver_bounce_not_fly_horizontally_ = true;
+  // screensaver drifts along a lissajous path instead of bouncing or flying
+  bool screensaver_lissajous_ = false;
+
+  // screensaver time in a color gradient on a palette canvas, falls back to one color when it does not fit
+  bool screensaver_gradient_ = false;
+
+  // time spent in FastDrawTwoColorBitmapSpi, printed with FPS in debug mode
+  unsigned long fast_draw_micros_ = 0;
+
+  // pixels, address windows and bytes sent to display by blits, printed with FPS in debug mode
+  RenderStats render_stats_ = {0, 0, 0};
+
+  // paces screensaver frames and sleeps between them, its stats are printed in debug mode
+  FrameGovernor screensaver_governor_;
+
+  // drawing commands from loop(), drawn by render task on dual core ESP32 and at end of loop() otherwise
+  RenderQueue render_queue_;
+  void ProcessRenderQueue();
+
+  // display backlight PWM, brightness changes fade on their own, duty and energy are printed in debug mode
+  Backlight backlight_;
+
+  // print last composed 1-bit canvas over serial as PBM image
+  void DumpCanvasPbm();
+
+  // draw every screen against its frame budget, report over serial, true if all within budget
+  bool RunRenderBenchmark();
+
+  // statically allocated memory for 1-bit canvases, public for instrumentation
+  CanvasArena canvas_arena_;
+
+  // settings pages are composed here and sent in one burst, public for instrumentation
+  DisplayList display_list_;
+
+  // drawing target of settings page functions: display, or display list while composing a page
+  Adafruit_GFX* gfx_ = &tft;
+
+  // rows drawn since screen was last redrawn carry this generation, see DisplayButton
+  uint16_t drawn_rows_generation_ = 1;
+
+  // page rows drawn in full straight to display, checked by render benchmark's display list overflow run
+  uint16_t page_rows_drawn_ = 0;
 
   // wifi networks scan page
   const int kWifiScanNetworksPageItems = 9;
@@ -119,33 +203,113 @@ private:
 
 // PRIVATE FUNCTIONS
 
-  void DrawSun(int16_t x0, int16_t y0, uint16_t edge, int &tone_note_index, unsigned long &next_tone_change_time);
-  void DrawRays(int16_t &cx, int16_t &cy, int16_t &rr, int16_t &rl, int16_t &rw, uint8_t &rn, int16_t &degStart, uint16_t &color);
-  void DrawDenseCircle(int16_t &cx, int16_t &cy, int16_t r, uint16_t &color);
+  bool PrepareSun(int16_t x0, int16_t y0, uint16_t edge);
+  void DrawSunFrame(uint8_t frame);
+  void DrawSunRaysAndDisk(ArenaCanvas1* canvas, uint8_t frame);
   void PickNewRandomColor();  // for screensaver
   void DrawButton(int16_t x, int16_t y, uint16_t w, uint16_t h, const char* label, uint16_t borderColor, uint16_t onFill, uint16_t offFill, bool isOn);
   void DrawTriangleButton(int16_t x, int16_t y, uint16_t w, uint16_t h, bool isUp, uint16_t borderColor, uint16_t fillColor);
-  void FastDrawTwoColorBitmapSpi(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg);
+  void FastDrawTwoColorBitmapSpi(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg);
+  void FastDrawPaletteBitmapSpi(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint8_t bits_per_pixel, const uint16_t* palette);
+  void ExpandPaletteRow(const uint8_t* bitmap_row, int16_t px_start, int16_t px_end, uint8_t bits_per_pixel, const uint16_t* palette, uint16_t* row_buffer);
+  void CountBlit(uint32_t pixels);
+  void DrawCurrentPage();
+  void ExecuteRenderCommand(RenderCommand command);
+  void LayoutRowButton(DisplayButton* button, int row_text_y0);
+  void DrawRowButton(DisplayButton* button, int row_text_y0, bool is_on);
+  void FlushDisplayList();
+  void BenchmarkDrawScreen(uint8_t screen, uint8_t run);
+  void BuildNibbleLut(uint16_t nibble_lut[16][4], uint16_t color, uint16_t bg);
+  void FastDrawTwoColorBitmapRegionSpi(uint8_t* bitmap, int16_t bitmap_w, int16_t bitmap_h, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint16_t bg);
+  void ExpandTwoColorRow(const uint8_t* bitmap_row, int16_t bit_start, int16_t bit_end, uint16_t* row_buffer, const uint16_t nibble_lut[16][4]);
+  void FastDrawSpritesSpi(int16_t x, int16_t y, const SpriteCompositor& sprites, uint16_t color, uint16_t bg);
+  // screensaver canvas
+  void LayoutScreensaver();
+  bool DrawScreensaverPaletteCanvas();
+  bool ComposeScreensaverSprites();
+  // screensaver delta redraw
+  void ScreensaverDeltaDraw(int16_t old_x, int16_t old_y, int16_t new_x, int16_t new_y, uint16_t color, uint16_t bg);
+  void ScreensaverDeltaSendSpan(const uint8_t* new_bits, int16_t span_start, int16_t span_end, int16_t x0, int16_t y, const uint16_t nibble_lut[16][4], uint16_t* row_buffer);
+  void ClearRectOutside(int16_t x, int16_t y, int16_t w, int16_t h, int16_t keep_x, int16_t keep_y, int16_t keep_w, int16_t keep_h);
+  // changed pixels closer than this are sent in one address window, the SPI cost of a new window
+  static const int16_t kScreensaverDeltaMergeGapPx = (DisplayTraits::kAddrWindowBytes + DisplayTraits::kBytesPerPixel - 1) / DisplayTraits::kBytesPerPixel;
   // keyboard functions
   void MakeKeyboard(const char type[][13], std::string label);
+  void SwitchKeyboardLayout();
+  const char (*KeyboardLayout())[13];
+  uint8_t KeyboardRows();
+  void DrawKeyboardKeyFace(uint8_t index, bool pressed);
+  bool KeyboardSpecialKeyShown(uint8_t key);
+  void KeyboardSpecialKeyRect(uint8_t key, int16_t* x, int16_t* y, int16_t* w, int16_t* h);
+  int8_t KeyboardSpecialKeyAt(int16_t x, int16_t y);
+  void DrawKeyboardSpecialKey(uint8_t key, bool pressed);
   void DrawKeyboardButton(int x, int y, int w, int h);
   void DrawKeyboardButton(int x, int y, int w, int h, uint16_t kb_btn_fill_col);
-  bool IsTouchWithin(int x, int y, int w, int h);
+  void DrawKeyboardText(const char* text, bool clear);
   bool GetKeyboardPress(char * textBuffer, std::string label, char * textReturn);
 
 
 // PRIVATE VARIABLES
 
   // static vars for GetKeyboardPress Keyboard
-  bool GetKeyboardPress_shift = false, GetKeyboardPress_lastShift = false, GetKeyboardPress_numpad = false, GetKeyboardPress_lastNumpad = false;
+  bool GetKeyboardPress_shift = false, GetKeyboardPress_numpad = false;
   bool kb_capitals_only = false, kb_numbers_only = false;
+  // character keys of shown layout and of layout shown before it, diffed on layout change
+  KeyboardSprites keyboard_sprites_[2];
+  uint8_t keyboard_shown_ = 0;
+  // a touch presses one key, it shows pressed until touch is released
+  bool keyboard_touch_down_ = false;
+  int8_t keyboard_pressed_key_ = -1, keyboard_pressed_special_key_ = -1;
+  const uint16_t kKeyboardTouchWaitMs = 100;
+  const uint16_t kKeyboardReleasePollMs = 20;
+  const int16_t kKeyboardButtonShadingPx = 3;
 
   // current screen brightness
   int current_brightness_ = 0;
 
   // screensaver
-  bool screensaver_move_down_ = true, screensaver_move_right_ = true;
-  GFXcanvas1* my_canvas_ = NULL;
+  ScreensaverMotion screensaver_motion_;
+  unsigned long screensaver_step_millis_ = 0;
+  uint8_t ScreensaverTargetFps();
+  ArenaCanvas1* my_canvas_ = NULL;
+  // gradient screensaver canvas and its palette: 0 background, time ramp, date, border
+  PaletteCanvas* palette_canvas_ = NULL;
+  uint16_t screensaver_palette_[16];
+  void BuildScreensaverPalette(uint8_t bits_per_pixel);
+  // one color screensaver: time, date and bell sprites composited while rows are sent, time and date
+  // are rendered into their own arena layers only when their text changes
+  SpriteCompositor screensaver_sprites_;
+  ArenaCanvas1* screensaver_time_layer_ = NULL;
+  ArenaCanvas1* screensaver_date_layer_ = NULL;
+  char screensaver_time_sprite_text_[kHHMM_ArraySize] = "";    // empty when time layer has to be rendered
+  bool screensaver_date_sprite_drawn_ = false;
+  // date row text, its font, bounds and advance, measured when text or font changes
+  const GFXfont* screensaver_date_font_ = NULL;
+  std::string screensaver_date_text_;
+  int16_t screensaver_date_gap_x_ = 0, screensaver_date_gap_y_ = 0;
+  uint16_t screensaver_date_w_ = 0, screensaver_date_h_ = 0;
+  // good morning sun: one arena canvas holding the frame sent to the display, the eyes and smile
+  // holes cut out of it and, when they fit, the rays and sun of every distinct frame pre-rendered
+  // as top halves, each part a box x box square but the top halves, sun center is at their middle
+  ArenaCanvas1* sun_canvas_ = NULL;
+  bool sun_frames_cached_ = false;
+  int16_t sun_x0_ = 0, sun_y0_ = 0;
+  int16_t sun_r_ = 0, sun_ray_r_ = 0, sun_ray_l_ = 0;
+  int16_t screensaver_date_advance_ = 0;
+  // date text cursor on canvas
+  int16_t screensaver_date_x0_ = 0, screensaver_date_y0_ = 0;
+
+  // main page time row character cells currently on screen, count 0 means full time row redraw is needed
+  static const uint8_t kTimeRowMaxCells = 12;
+  TimeRowCell displayed_time_row_cells_[kTimeRowMaxCells];
+  uint8_t displayed_time_row_cell_count_ = 0;
+  uint8_t LayoutTimeRowCells(int16_t hh_gap_x, TimeRowCell* cells);
+  uint8_t LayoutTextCells(const GlyphAtlas& atlas, const char* text, int16_t x, int16_t baseline_y, TimeRowCell* cells, uint8_t cell_count, int16_t* cursor_x);
+
+  // clock digits pre-rendered at startup
+  const GlyphAtlas screensaver_time_atlas_ = GlyphAtlas(&ComingSoon_Regular70pt7bSpans, "0123456789:");
+  const GlyphAtlas main_time_atlas_ = GlyphAtlas(&FreeSansBold48pt7bSpans, "0123456789:");
+  const GlyphAtlas main_time_small_atlas_ = GlyphAtlas(&FreeSans18pt7b, "0123456789:AMP");
 
   // location of various display text strings
   int16_t gap_right_x_ = 0, gap_up_y_ = 0;
@@ -153,6 +317,12 @@ private:
   uint16_t tft_HHMM_w_ = 0, tft_HHMM_h_ = 0;
   int16_t screensaver_x1_ = 0, screensaver_y1_ = 0;
   uint16_t screensaver_w_ = 0, screensaver_h_ = 0;
+  // position and size of screensaver canvas last drawn on screen, used for delta redraw
+  bool screensaver_drawn_ = false;
+  bool hardware_scroll_on_ = false;
+  uint16_t hardware_scroll_start_ = 0;
+  int16_t screensaver_drawn_x1_ = 0, screensaver_drawn_y1_ = 0;
+  uint16_t screensaver_drawn_w_ = 0, screensaver_drawn_h_ = 0;
   int16_t tft_AmPm_x0_ = 0, tft_AmPm_y0_ = 0;
   int16_t tft_SS_x0_ = 0;
   int16_t date_row_x0_ = 0;
@@ -166,13 +336,17 @@ private:
 
   // display brightness constants
   const int kMaxBrightness = 255;
+  // wake on touch or button is quick, dimming with ambient light or time of day is slow
+  const uint16_t kBacklightWakeFadeMs = 150;
+  const uint16_t kBacklightDimFadeMs = 1500;
   // display brightness constants
   const int kBrightnessInactiveMax = 150;
   const int kBrightnessBackgroundColorThreshold = 40;
 
-  // photoresistor pin's adc resolution (for all ADCs on MCU)
-  const int kAdcResolutionBits = 8;
-  const int kPhotodiodeLightRawMax = pow(2, kAdcResolutionBits) - 1;
+  // photoresistor light sensing and its LDR reading to brightness curve, from kNightBrightness
+  // at 0.2 V to kBrightnessInactiveMax at full scale, points evenly spaced in log of reading
+  AmbientLight ambient_light_;
+  const AmbientLightPoint kAmbientLightCurve[7] = {{248, 1}, {400, 3}, {640, 8}, {1024, 20}, {1640, 45}, {2600, 90}, {4095, 150}};
 
   // display brightness constants
   const int kNightBrightness = 1;
@@ -181,6 +355,29 @@ private:
   const int kEveningBrightness = 100;
   const int kDayBrightness = 150;
 
+  // screensaver gap around text, sprites and arena layers
+  constexpr static int16_t kScreensaverGapBand = 5;
+  constexpr static uint8_t kScreensaverTimeSprite = 0, kScreensaverDateSprite = 1, kScreensaverBellSprite = 2;
+  constexpr static uint8_t kScreensaverTimeLayer = 0, kScreensaverDateLayer = 1;
+
+  // screensaver frame rates, dim display, night time and slow cpu draw fewer frames to save power
+  const uint8_t kScreensaverNightFps = 10;
+  const uint8_t kScreensaverEveningFps = 25;
+  const uint8_t kScreensaverDayFps = 50;
+
+  // good morning sun animation, shares arena with screensaver
+  constexpr static unsigned long kGoodMorningScreenMs = 5000;
+  constexpr static uint16_t kSunFrameMs = 30;
+  constexpr static uint8_t kSunFrames = 120;
+  constexpr static uint8_t kSunRays = 12;
+  constexpr static int16_t kSunRayHalfWidth = 2;
+  constexpr static int16_t kSunMaxVariation = 5;
+  // rays turn 1 degree a frame and sun pulses every 10 frames, so a frame looks like the one a ray
+  // spacing earlier, and frame kSunRepeatFrames - f is frame f mirrored top to bottom
+  constexpr static uint8_t kSunRepeatFrames = 360 / kSunRays;
+  constexpr static uint8_t kSunCachedFrames = kSunRepeatFrames / 2 + 1;
+  static_assert(kSunRepeatFrames % 10 == 0, "sun pulse has to repeat with rays");
+
 
   // color definitions
   const uint16_t  kDisplayColorBlack        = 0x0000;
@@ -245,237 +442,6 @@ private:
   const uint16_t kButtonFillColor = kDisplayColorOrange;
   const uint16_t kButtonClickedFillColor = kDisplayColorRed;
 
-  // BIG BELL ICONS
-
-  const uint8_t kBellWidth = 114, kBellHeight = 75;
-  // 'bell_114x75, 114x75px
-  // convert image into binary monochrome using https://javl.github.io/image2cpp/
-  const unsigned char kBellBitmap[1125] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x07, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x1f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 
-    0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-    0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 
-    0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 
-    0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xe0, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x80, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x07, 
-    0xe0, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x07, 0xf8, 
-    0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x07, 0xfe, 0x00, 
-    0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x07, 0xff, 0x80, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x80, 0x7f, 0xf8, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0x80, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xc0, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xc0, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xe0, 0x1f, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xf0, 0x3f, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xf0, 0x3f, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-    0x3f, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 
-    0xff, 0xfe, 0x00, 0x1f, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x0f, 
-    0xfc, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0e, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 
-    0x00, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x1f, 0xf8, 0x00, 
-    0x00, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x00, 
-    0x03, 0xff, 0xf8, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x0f, 0xff, 0xe0, 0x00, 0x1f, 
-    0xff, 0xc0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x01, 0xff, 0xfc, 0x00, 0x3f, 0xfe, 
-    0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x3f, 0xf0, 0x00, 
-    0x00, 0x00, 0x03, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x3f, 0x80, 0x00, 0x00, 
-    0x00, 0x01, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x3f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 
-    0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00
-  };
-
-  const uint8_t kBellFallenWidth = 75, kBellFallenHeight = 71;
-  // 'bell_fallen_75x71, 75x71px
-  const unsigned char kBellFallenBitmap[710] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 
-    0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x1f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xfc, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 
-    0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7c, 
-    0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x80, 0x00, 0x00, 0x03, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xe0, 0x00, 
-    0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xf8, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfc, 0x00, 0x00, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xfe, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xef, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-    0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xf7, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 
-    0xfe, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfd, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0x00, 
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xfe, 0xf8, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf0, 0x00, 0x3f, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0x40, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0x80, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xc0, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x07, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x7f, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xf0, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 
-    0x00, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xe0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x80, 
-    0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-  };
-
-  // SMALL BELL ICONS
-
-  const uint8_t kBellSmallWidth = 70, kBellSmallHeight = 46;
-  // 'bell_114x75', 70x46px
-  const unsigned char kBellSmallBitmap [414] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff,
-    0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xfe, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x07, 0xff, 0xff, 0xff,
-    0x00, 0x03, 0xc0, 0x1f, 0x80, 0x0f, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xc0, 0x1f, 0xe0, 0x0f, 0xff,
-    0xff, 0xff, 0x80, 0x3f, 0xc0, 0x07, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0x80, 0xff, 0x00, 0x01, 0xfe,
-    0x0f, 0xff, 0xff, 0xff, 0x83, 0xfc, 0x00, 0x00, 0x7f, 0x0f, 0xff, 0xff, 0xff, 0xc3, 0xf8, 0x00,
-    0x00, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xc3, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xc0,
-    0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff,
-    0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x1f,
-    0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x1f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xe0, 0xf8,
-    0x00, 0x3f, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xf0, 0x7f, 0xfc, 0x3f, 0xff, 0xff, 0xff,
-    0xe1, 0xff, 0xf0, 0x7f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0xff,
-    0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00,
-    0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x7c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x03, 0xfc, 0x00, 0x1f, 0xff, 0xc0, 0x00, 0xff, 0x00, 0x1f,
-    0xf8, 0x00, 0x1f, 0xff, 0xc0, 0x00, 0xff, 0xc0, 0x7f, 0xe0, 0x00, 0x0f, 0xff, 0xc0, 0x00, 0x3f,
-    0xf0, 0x7f, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x03, 0xf0, 0x78, 0x00, 0x00, 0x03, 0xff, 0x00,
-    0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-  };
-
-  const uint8_t kBellFallenSmallWidth = 49, kBellFallenSmallHeight = 46;
-  // 'bell_fallen_75x71', 49x46px
-  const unsigned char kBellFallenSmallBitmap [322] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xe0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xf0, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf7,
-    0x80, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xf7, 0xc0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,
-    0x01, 0xff, 0xff, 0xff, 0xfb, 0xf8, 0x00, 0x03, 0xff, 0xff, 0xff, 0xfb, 0xf8, 0x00, 0x07, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xff,
-    0xfd, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xfe, 0xfc,
-    0x00, 0x1f, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0x78, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x78, 0x00, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x07, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,
-    0x3f, 0xff, 0xf8, 0x0f, 0xe0, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x80, 0x00, 0x00, 0x01, 0xf0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00
-  };
-
-  // 'gear-settings-1-48', 40x40px
-  const unsigned char kSettingsGearBitmap[200] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
-    0x01, 0xff, 0x00, 0x00, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x01, 0x83, 0x80, 0x00, 0x00, 0x01, 
-    0x83, 0x80, 0x00, 0x00, 0x03, 0x81, 0x80, 0x00, 0x07, 0x0f, 0x81, 0xe1, 0xe0, 0x0f, 0xff, 0x00, 
-    0xff, 0xf0, 0x1d, 0xf8, 0x00, 0x3f, 0xf0, 0x18, 0x30, 0x00, 0x0c, 0x38, 0x38, 0x00, 0x38, 0x00, 
-    0x18, 0x30, 0x00, 0xff, 0x00, 0x1c, 0x78, 0x03, 0xff, 0x80, 0x1c, 0x3c, 0x03, 0x81, 0xc0, 0x38, 
-    0x1e, 0x07, 0x00, 0xe0, 0x70, 0x07, 0x0e, 0x00, 0x60, 0xe0, 0x07, 0x0c, 0x00, 0x60, 0xc0, 0x03, 
-    0x0c, 0x00, 0x70, 0xc0, 0x07, 0x0c, 0x00, 0x70, 0xc0, 0x03, 0x0c, 0x00, 0x70, 0xc0, 0x07, 0x0e, 
-    0x00, 0x60, 0xe0, 0x0e, 0x06, 0x00, 0xe0, 0xf0, 0x1c, 0x07, 0x01, 0xc0, 0x78, 0x38, 0x03, 0xc3, 
-    0xc0, 0x3c, 0x70, 0x01, 0xff, 0x00, 0x1c, 0x30, 0x00, 0x7e, 0x00, 0x1c, 0x38, 0x00, 0x00, 0x00, 
-    0x18, 0x1c, 0xf8, 0x00, 0x1e, 0x38, 0x1f, 0xfc, 0x00, 0x7f, 0xf0, 0x0f, 0xdf, 0x01, 0xf3, 0xe0, 
-    0x04, 0x07, 0x81, 0xc0, 0x40, 0x00, 0x01, 0x81, 0x80, 0x00, 0x00, 0x01, 0x83, 0x80, 0x00, 0x00, 
-    0x01, 0x83, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x00, 
-    0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-  };
-
-  // KEYBOARD
-
-  const char Mobile_KB_Capitals[3][13] PROGMEM = {
-    {0, 13, 10, 'Q', 'W', 'E', 'R', 'T', 'Y', 'U', 'I', 'O', 'P'},
-    {1, 12, 9, 'A', 'S', 'D', 'F', 'G', 'H', 'J', 'K', 'L'},
-    {3, 10, 7, 'Z', 'X', 'C', 'V', 'B', 'N', 'M'},
-  };
-
-  const char Mobile_KB_Smalls[3][13] PROGMEM = {
-    {0, 13, 10, 'q', 'w', 'e', 'r', 't', 'y', 'u', 'i', 'o', 'p'},
-    {1, 12, 9, 'a', 's', 'd', 'f', 'g', 'h', 'j', 'k', 'l'},
-    {3, 10, 7, 'z', 'x', 'c', 'v', 'b', 'n', 'm'},
-  };
-
-  const char Mobile_NumKeys[3][13] PROGMEM = {
-    {0, 13, 10, '1', '2', '3', '4', '5', '6', '7', '8', '9', '0'},
-    {0, 13, 10, '-', '/', ':', ';', '(', ')', '$', '&', '@', '"'},
-    {5, 8, 5, '.', ',', '?', '!', '\''}
-  };
-
-  const char Mobile_SymKeys[3][13] PROGMEM = {
-    {0, 13, 10, '[', ']', '{', '}', '#', '%', '^', '*', '+', '='},
-    {4, 9, 6, '_', '\\', '|', '~', '<', '>'}, //4
-    {5, 8, 5, '.', ',', '?', '!', '\''}
-  };
-
   const int16_t kTextAreaHeight = 100;
   
 
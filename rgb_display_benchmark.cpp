@@ -0,0 +1,283 @@
+#include "rgb_display.h"
+#include "alarm_clock.h"
+
+// Render benchmark: every screen is drawn on the real panel and its average wall time
+// is checked against a frame budget. Budgets are for a 320x240 ST7789V at 80MHz SPI,
+// slower controllers are expected to miss some of them.
+// Pixels, address windows and SPI bytes count only canvas blits (FastDraw*Bitmap*Spi),
+// Adafruit_GFX primitives drawn straight to the panel are not counted.
+// Some screens are drawn twice to compare a rendering path with the one it replaced:
+// "Screensaver" sends changed pixels, "Screensaver full redraw" the whole canvas every frame,
+// "Screensaver gradient" the whole 4-bit palette canvas. "Expand rows" pairs expand 1-bit rows of
+// the screensaver canvas size laid out by the screensaver runs to RGB565 without sending them, bit by
+// bit as before the nibble LUT, and with it. tools/expand_rows_bench.cpp times the pair on a host.
+// "SettingsPage list overflow" caps the display list so the page overflows it and is drawn
+// directly, it fails unless every row of the page reached the display.
+// Heap is free heap lost over the runs of a screen, it should stay 0. Allocations are the
+// operator new calls made while drawing, also the ones freed again, counted on ESP32 only.
+
+#if defined(MCU_IS_ESP32)
+#include <new>
+
+// Global operator new is replaced to count allocations of the task running the benchmark, the
+// ESP32 core leaves it to libstdc++ where it is replaceable, and new[] and nothrow new go through
+// it. Canvases are in the arena, so what is counted is std::string and container growth. Direct
+// malloc() calls are not counted.
+static TaskHandle_t benchmark_alloc_task = NULL;
+static uint32_t benchmark_alloc_count = 0, benchmark_alloc_bytes = 0;
+
+void* operator new(size_t size) {
+  if(benchmark_alloc_task != NULL && xTaskGetCurrentTaskHandle() == benchmark_alloc_task) {
+    benchmark_alloc_count++;
+    benchmark_alloc_bytes += size;
+  }
+  void* ptr = malloc(size > 0 ? size : 1);
+  if(ptr == NULL) {
+#if defined(__cpp_exceptions)
+    throw std::bad_alloc();
+#else
+    abort();
+#endif
+  }
+  return ptr;
+}
+#endif
+
+enum BenchmarkScreen {
+  kBenchTimeUpdateFull = 0,
+  kBenchTimeUpdate,
+  kBenchScreensaver,
+  kBenchScreensaverFull,
+  kBenchScreensaverGradient,
+  kBenchScreensaverSettingsPage,
+  kBenchSettingsPage,
+  kBenchWiFiSettingsPage,
+  kBenchLocationAndWeatherSettingsPage,
+  kBenchSettingsPageOverflow,
+  kBenchSetAlarmScreen,
+  kBenchAlarmTriggeredScreenFull,
+  kBenchAlarmTriggeredScreen,
+  kBenchGoodMorningSun,
+  kBenchKeyboard,
+  kBenchKeyboardShift,
+  kBenchExpandRowsPerBit,
+  kBenchExpandRowsNibbleLut,
+  kBenchScreenCount
+};
+
+struct BenchmarkBudget {
+  const char* name;
+  uint8_t runs;
+  uint32_t budget_us;     // average wall time per run
+};
+
+const BenchmarkBudget kBenchmarkBudgets[kBenchScreenCount] = {
+  {"DisplayTimeUpdate full", 5, 60000},
+  {"DisplayTimeUpdate", 20, 12000},
+  {"Screensaver", 50, 8000},
+  {"Screensaver full redraw", 50, 20000},  // 1-bit canvas sent whole every frame, compare with Screensaver
+  {"Screensaver gradient", 50, 20000},     // 4-bit palette canvas sent whole every frame, compare with full redraw
+  {"ScreensaverSettingsPage", 5, 80000},
+  {"SettingsPage", 5, 80000},
+  {"WiFiSettingsPage", 5, 80000},
+  {"LocationAndWeatherSettingsPage", 5, 80000},
+  {"SettingsPage list overflow", 5, 80000},  // display list capped, page drawn directly after recording
+  {"SetAlarmScreen", 5, 60000},
+  {"AlarmTriggeredScreen full", 5, 70000},
+  {"AlarmTriggeredScreen", 20, 8000},
+  {"GoodMorningScreen sun", 120, 10000},   // one frame, canvas around sun sent whole
+  {"MakeKeyboard", 5, 60000},
+  {"Keyboard shift", 10, 8000},           // capitals <-> smalls, only key faces are sent
+  {"Expand rows per bit", 10, 8000},      // screensaver canvas 1-bit to RGB565, nothing sent
+  {"Expand rows nibble LUT", 10, 2000},   // same rows, compare with per bit
+};
+
+// display list cap of the overflow run, page title alone records more glyphs
+const uint16_t kBenchOverflowCommands = 8;
+
+// expand a 1-bit row a pixel at a time, as FastDrawTwoColorBitmapSpi did before its nibble LUT
+static void ExpandTwoColorRowPerBit(const uint8_t* bitmap_row, int16_t bit_start, int16_t bit_end, uint16_t* row_buffer, uint16_t color, uint16_t bg) {
+  uint8_t currentByte = bitmap_row[bit_start >> 3];
+  for (int16_t i = bit_start; i < bit_end; i++) {
+    uint8_t bitIndex = 7 - i % 8;
+    if (bitIndex == 7)  // new byte
+      currentByte = bitmap_row[i >> 3];
+    *row_buffer++ = (((currentByte >> bitIndex) & 0x01) ? color : bg);
+  }
+}
+
+// draw one run of a benchmark screen
+void RGBDisplay::BenchmarkDrawScreen(uint8_t screen, uint8_t run) {
+  switch(screen) {
+    case kBenchTimeUpdateFull:
+      redraw_display_ = true;
+      DisplayTimeUpdate();
+      break;
+    case kBenchTimeUpdate:
+      DisplayTimeUpdate();
+      break;
+    case kBenchScreensaver:
+    case kBenchScreensaverFull:
+    case kBenchScreensaverGradient:
+      if(run == 0) refresh_screensaver_canvas_ = true;
+      // without a drawn canvas to diff against, canvas is sent whole
+      if(screen == kBenchScreensaverFull) screensaver_drawn_ = false;
+      Screensaver(1000 / kScreensaverDayFps);   // motion of one frame at day frame rate cap
+      break;
+    case kBenchScreensaverSettingsPage:
+      current_page = kScreensaverSettingsPage;
+      DisplayCurrentPage();
+      break;
+    case kBenchSettingsPage:
+    case kBenchSettingsPageOverflow:
+      current_page = kSettingsPage;
+      DisplayCurrentPage();
+      break;
+    case kBenchWiFiSettingsPage:
+      current_page = kWiFiSettingsPage;
+      DisplayCurrentPage();
+      break;
+    case kBenchLocationAndWeatherSettingsPage:
+      current_page = kLocationAndWeatherSettingsPage;
+      DisplayCurrentPage();
+      break;
+    case kBenchSetAlarmScreen:
+      SetAlarmScreen(/* process_user_input = */ false, false, false, false);
+      break;
+    case kBenchAlarmTriggeredScreenFull:
+      AlarmTriggeredScreen(/* first_time = */ true, 25);
+      break;
+    case kBenchAlarmTriggeredScreen:
+      AlarmTriggeredScreen(/* first_time = */ false, 25 - run);
+      break;
+    case kBenchGoodMorningSun:
+      DrawSunFrame(run);
+      break;
+    case kBenchKeyboard:
+      tft.fillScreen(kDisplayBackroundColor);
+      MakeKeyboard(Mobile_KB_Smalls, "Benchmark:");
+      break;
+    case kBenchKeyboardShift:
+      GetKeyboardPress_shift = !GetKeyboardPress_shift;
+      SwitchKeyboardLayout();
+      break;
+    case kBenchExpandRowsPerBit:
+    case kBenchExpandRowsNibbleLut: {
+      // rows of screensaver canvas size from whatever the arena holds, it is at least a full 1-bit screen
+      const uint8_t* bitmap = canvas_arena_.LastCanvas()->getBuffer();
+      int16_t bitmap_width_bytes = (screensaver_w_ + 7) >> 3;
+      uint16_t color = kColorPickerWheel[run % kColorPickerWheelSize];
+      uint16_t nibble_lut[16][4];
+      BuildNibbleLut(nibble_lut, color, kDisplayBackroundColor);
+      uint16_t buffer16Bit[kTftWidth];
+      static volatile uint16_t expanded_sink;
+      for (int16_t j = 0; j < screensaver_h_; j++) {
+        if(screen == kBenchExpandRowsPerBit)
+          ExpandTwoColorRowPerBit(&bitmap[j * bitmap_width_bytes], 0, screensaver_w_, buffer16Bit, color, kDisplayBackroundColor);
+        else
+          ExpandTwoColorRow(&bitmap[j * bitmap_width_bytes], 0, screensaver_w_, buffer16Bit, nibble_lut);
+        expanded_sink = buffer16Bit[j % screensaver_w_];
+      }
+      break;
+    }
+  }
+}
+
+/*!
+    @brief  Draw every screen, print wall time, blit stats, allocations and heap change per screen
+            and whether it is within its frame budget. Leaves the display on a blank
+            screen, caller has to set a page after.
+    @return true if all screens are within their budgets
+*/
+bool RGBDisplay::RunRenderBenchmark() {
+  ScreenPage page_before = current_page;
+  bool screensaver_gradient_before = screensaver_gradient_;
+  bool all_passed = true;
+  Serial.println(F("screen, runs, us/run, budget us, pixels/run, windows/run, SPI B/run, allocs/run, alloc B/run, heap change B, result"));
+
+  for(uint8_t screen = 0; screen < kBenchScreenCount; screen++) {
+    const BenchmarkBudget& budget = kBenchmarkBudgets[screen];
+
+    // screen specific setup, outside of the timing
+    if(screen == kBenchTimeUpdateFull || screen == kBenchTimeUpdate)
+      current_page = kMainPage;
+    else if(screen == kBenchScreensaver || screen == kBenchScreensaverFull || screen == kBenchScreensaverGradient) {
+      current_page = kScreensaverPage;
+      screensaver_gradient_ = (screen == kBenchScreensaverGradient);
+      ScreensaverControl(true);
+    }
+    else if(screen == kBenchSetAlarmScreen) {
+      alarm_clock->var_1_ = alarm_clock->alarm_hr_;
+      alarm_clock->var_2_ = alarm_clock->alarm_min_;
+      alarm_clock->var_3_is_AM_ = alarm_clock->alarm_is_AM_;
+      alarm_clock->var_4_ON_ = alarm_clock->alarm_ON_;
+    }
+    else if(screen == kBenchKeyboard || screen == kBenchKeyboardShift) {
+      kb_numbers_only = false;
+      kb_capitals_only = false;
+      GetKeyboardPress_shift = false;
+      GetKeyboardPress_numpad = false;
+    }
+    else if(screen == kBenchExpandRowsPerBit)
+      Serial.printf("Expand rows canvas %ux%u\n", screensaver_w_, screensaver_h_);
+    else if(screen == kBenchSettingsPageOverflow) {
+      display_list_.LimitCommands(kBenchOverflowCommands);
+      page_rows_drawn_ = 0;
+    }
+    else if(screen == kBenchGoodMorningSun) {
+      tft.fillScreen(kDisplayColorBlack);
+      if(!PrepareSun(80, 80, 160)) {
+        Serial.printf("%s, arena too small, FAIL\n", budget.name);
+        all_passed = false;
+        continue;
+      }
+    }
+
+    render_stats_ = {0, 0, 0};
+    int heap_before = AvailableRam();
+#if defined(MCU_IS_ESP32)
+    benchmark_alloc_count = 0;
+    benchmark_alloc_bytes = 0;
+    benchmark_alloc_task = xTaskGetCurrentTaskHandle();
+#endif
+    unsigned long total_us = 0;
+    for(uint8_t run = 0; run < budget.runs; run++) {
+      ResetWatchdog();
+      elapsedMicros timer;
+      BenchmarkDrawScreen(screen, run);
+      total_us += timer;
+    }
+#if defined(MCU_IS_ESP32)
+    benchmark_alloc_task = NULL;
+    int allocs_per_run = benchmark_alloc_count / budget.runs, alloc_bytes_per_run = benchmark_alloc_bytes / budget.runs;
+#else
+    int allocs_per_run = -1, alloc_bytes_per_run = -1;    // not counted
+#endif
+    int heap_change = AvailableRam() - heap_before;
+
+    if(screen == kBenchScreensaver || screen == kBenchScreensaverFull || screen == kBenchScreensaverGradient)
+      ScreensaverControl(false);
+
+    uint32_t us_per_run = total_us / budget.runs;
+    bool passed = (us_per_run <= budget.budget_us && heap_change >= 0);
+    if(screen == kBenchSettingsPageOverflow) {
+      display_list_.LimitCommands(UINT16_MAX);
+      uint16_t page_rows = display_pages_vec[kSettingsPage].size() * budget.runs;
+      if(!display_list_.overflowed() || page_rows_drawn_ != page_rows) {
+        Serial.printf("%s, overflow %d, rows drawn %u of %u\n", budget.name, display_list_.overflowed(), page_rows_drawn_, page_rows);
+        passed = false;
+      }
+    }
+    all_passed = all_passed && passed;
+    Serial.printf("%s, %u, %u, %u, %u, %u, %u, %d, %d, %d, %s\n", budget.name, budget.runs, us_per_run, budget.budget_us,
+      render_stats_.pixels / budget.runs, render_stats_.addr_windows / budget.runs, render_stats_.bytes / budget.runs, allocs_per_run, alloc_bytes_per_run, heap_change, (passed ? "PASS" : "FAIL"));
+  }
+
+  render_stats_ = {0, 0, 0};
+  current_page = page_before;
+  screensaver_gradient_ = screensaver_gradient_before;
+  tft.fillScreen(kDisplayBackroundColor);
+  redraw_display_ = true;
+  Serial.println(all_passed ? F("Render benchmark PASS") : F("Render benchmark FAIL"));
+  return all_passed;
+}
@@ -3,6 +3,7 @@
 #include "wifi_stuff.h"
 #include "rtc.h"
 #include "touchscreen.h"
+#include "fixed_trig.h"
 
 /*!
     @brief  Draw a 565 RGB image at the specified (x,y) position using monochrome 8-bit image.
@@ -11,13 +12,15 @@
             adapted from https://github.com/PaulStoffregen/ILI9341_t3
             by Marc MERLIN. See examples/pictureEmbed to use this.
             Handles its own transaction and edge clipping/rejection.
+            Bitmap rows are expanded a whole byte at a time using a 16 entry nibble
+            lookup table built for the color / bg pair of this call.
     @param  x        Top left corner horizontal coordinate.
     @param  y        Top left corner vertical coordinate.
     @param  bitmap   Pointer to 8-bit array of monochrome image
     @param  w        Width of bitmap in pixels.
     @param  h        Height of bitmap in pixels.
 */
-void RGBDisplay::FastDrawTwoColorBitmapSpi(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+void RGBDisplay::FastDrawTwoColorBitmapSpi(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
   int16_t x2, y2;                 // Lower-right coord
   if ((x >= kTftWidth) ||            // Off-edge right
       (y >= kTftHeight) ||           // " top
@@ -25,7 +28,7 @@ void RGBDisplay::FastDrawTwoColorBitmapSpi(int16_t x, int16_t y, uint8_t *bitmap
       ((y2 = (y + h - 1)) < 0))
     return; // " bottom
 
-  // elapsedMillis timer1;
+  elapsedMicros timer1;
 
   int bx1 = 0, by1 = 0, // Clipped top-left within bitmap
       saveW = w,            // Save original bitmap width value
@@ -48,6 +51,10 @@ void RGBDisplay::FastDrawTwoColorBitmapSpi(int16_t x, int16_t y, uint8_t *bitmap
   int16_t jLim = min(saveH, h + by1);
   int16_t iLim = min(saveW, w + bx1);
 
+  // nibble lookup table: 4 RGB565 pixels for every 4-bit pattern of the bitmap
+  uint16_t nibble_lut[16][4];
+  BuildNibbleLut(nibble_lut, color, bg);
+
   // new 16 bit buffter of length w to hold 1 row colors
   uint16_t buffer16Bit[w];
   tft.startWrite();
@@ -55,24 +62,281 @@ void RGBDisplay::FastDrawTwoColorBitmapSpi(int16_t x, int16_t y, uint8_t *bitmap
 
   int16_t bitmapWidthBytes = (saveW + 7) >> 3;          // bitmap width in bytes
   for (int16_t j = by1; j < jLim; j++) {
-    int bufi = 0;
-    int16_t i = bx1;
-    uint8_t currentByte = bitmap[j * bitmapWidthBytes + (i >> 3)];
-    uint8_t bitIndex = 7 - i % 8;
-    while(1) {
-      buffer16Bit[bufi] = (((currentByte >> bitIndex)  & 0x01) ? color : bg);
-      bufi++;   // next row buffer index
-      i++;  // next pixel
-      if(i >= iLim)
-        break;
-      bitIndex = 7 - i % 8; // next bit index
-      if(bitIndex == 7)  // new byte
-        currentByte = bitmap[j * bitmapWidthBytes + (i >> 3)];
+    ExpandTwoColorRow(&bitmap[j * bitmapWidthBytes], bx1, iLim, buffer16Bit, nibble_lut);
+    DisplayRowPusher::Push(tft, buffer16Bit, w);
+  }
+  tft.endWrite();
+  fast_draw_micros_ += timer1;
+  CountBlit(w * h);
+}
+
+/*!
+    @brief  Draw region (x, y, w, h) of a monochrome bitmap whose top left corner is at screen origin,
+            at the same place on screen. Region is clipped to bitmap and screen.
+    @param  bitmap     Pointer to 8-bit array of monochrome image placed at screen (0, 0)
+    @param  bitmap_w   Width of bitmap in pixels.
+    @param  bitmap_h   Height of bitmap in pixels.
+    @param  x, y, w, h Region of bitmap to draw.
+*/
+void RGBDisplay::FastDrawTwoColorBitmapRegionSpi(uint8_t* bitmap, int16_t bitmap_w, int16_t bitmap_h, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+  int16_t x2 = min((int16_t)(x + w), min(bitmap_w, (int16_t)kTftWidth));
+  int16_t y2 = min((int16_t)(y + h), min(bitmap_h, (int16_t)kTftHeight));
+  x = max(x, (int16_t)0);
+  y = max(y, (int16_t)0);
+  if(x >= x2 || y >= y2)
+    return;
+  w = x2 - x;
+  h = y2 - y;
+
+  elapsedMicros timer1;
+
+  uint16_t nibble_lut[16][4];
+  BuildNibbleLut(nibble_lut, color, bg);
+
+  uint16_t buffer16Bit[w];
+  tft.startWrite();
+  tft.setAddrWindow(x, y, w, h);
+
+  int16_t bitmapWidthBytes = (bitmap_w + 7) >> 3;
+  for (int16_t j = y; j < y2; j++) {
+    ExpandTwoColorRow(&bitmap[j * bitmapWidthBytes], x, x2, buffer16Bit, nibble_lut);
+    DisplayRowPusher::Push(tft, buffer16Bit, w);
+  }
+  tft.endWrite();
+  fast_draw_micros_ += timer1;
+  CountBlit(w * h);
+}
+
+/*!
+    @brief  Draw a sprite composite at the specified (x,y) position, rows are composed into a bit row
+            and expanded like FastDrawTwoColorBitmapSpi. Same clipping and row buffer.
+    @param  x        Top left corner horizontal coordinate.
+    @param  y        Top left corner vertical coordinate.
+    @param  sprites  Sprites and size of the composite.
+*/
+void RGBDisplay::FastDrawSpritesSpi(int16_t x, int16_t y, const SpriteCompositor& sprites, uint16_t color, uint16_t bg) {
+  int16_t w = sprites.width(), h = sprites.height();
+  int16_t bx1 = max((int16_t)-x, (int16_t)0), by1 = max((int16_t)-y, (int16_t)0);    // clipped top-left within composite
+  int16_t x2 = min((int16_t)(x + w), (int16_t)kTftWidth), y2 = min((int16_t)(y + h), (int16_t)kTftHeight);
+  x = max(x, (int16_t)0);
+  y = max(y, (int16_t)0);
+  if(x >= x2 || y >= y2)
+    return;
+  w = x2 - x;
+  h = y2 - y;
+
+  elapsedMicros timer1;
+
+  uint16_t nibble_lut[16][4];
+  BuildNibbleLut(nibble_lut, color, bg);
+
+  uint8_t row_bits[(kTftWidth + 7) / 8];
+  uint16_t buffer16Bit[w];
+  tft.startWrite();
+  tft.setAddrWindow(x, y, w, h);
+
+  for (int16_t j = by1; j < by1 + h; j++) {
+    sprites.ComposeRowBits(j, -bx1, row_bits, w);
+    ExpandTwoColorRow(row_bits, 0, w, buffer16Bit, nibble_lut);
+    DisplayRowPusher::Push(tft, buffer16Bit, w);
+  }
+  tft.endWrite();
+  fast_draw_micros_ += timer1;
+  CountBlit(w * h);
+}
+
+/*!
+    @brief  Draw a 2 or 4 bits per pixel palette indexed bitmap at the specified (x,y) position.
+            Same clipping and row buffer as FastDrawTwoColorBitmapSpi, each bitmap
+            row is expanded into RGB565 colors through the palette.
+    @param  x, y             Top left corner.
+    @param  bitmap           Pointer to bitmap, rows byte aligned, leftmost pixel in high bits.
+    @param  w, h             Size of bitmap in pixels.
+    @param  bits_per_pixel   2 or 4
+    @param  palette          RGB565 color of each of the (1 << bits_per_pixel) indexes
+*/
+void RGBDisplay::FastDrawPaletteBitmapSpi(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint8_t bits_per_pixel, const uint16_t* palette) {
+  int16_t x2, y2;
+  if ((x >= kTftWidth) || (y >= kTftHeight) || ((x2 = (x + w - 1)) < 0) || ((y2 = (y + h - 1)) < 0))
+    return;
+
+  elapsedMicros timer1;
+
+  int bx1 = 0, by1 = 0, saveW = w, saveH = h;
+  if (x < 0) {
+    w += x;
+    bx1 = -x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    by1 = -y;
+    y = 0;
+  }
+  if (x2 >= kTftWidth)
+    w = kTftWidth - x;
+  if (y2 >= kTftHeight)
+    h = kTftHeight - y;
+
+  int16_t jLim = min(saveH, h + by1);
+  int16_t iLim = min(saveW, w + bx1);
+
+  uint16_t buffer16Bit[w];
+  tft.startWrite();
+  tft.setAddrWindow(x, y, w, h);
+
+  int16_t bitmapWidthBytes = (saveW * bits_per_pixel + 7) >> 3;
+  for (int16_t j = by1; j < jLim; j++) {
+    ExpandPaletteRow(&bitmap[j * bitmapWidthBytes], bx1, iLim, bits_per_pixel, palette, buffer16Bit);
+    DisplayRowPusher::Push(tft, buffer16Bit, w);
+  }
+  tft.endWrite();
+  fast_draw_micros_ += timer1;
+  CountBlit(w * h);
+}
+
+// expand pixels [px_start, px_end) of one palette bitmap row into RGB565 colors, whole bytes at a time past an unaligned head
+void RGBDisplay::ExpandPaletteRow(const uint8_t* bitmap_row, int16_t px_start, int16_t px_end, uint8_t bits_per_pixel, const uint16_t* palette, uint16_t* row_buffer) {
+  uint8_t pixels_per_byte = 8 / bits_per_pixel;
+  uint8_t index_mask = (1 << bits_per_pixel) - 1;
+  int16_t i = px_start;
+  // unaligned head and tail, pixel by pixel
+  for (; i < px_end && (i % pixels_per_byte); i++)
+    *row_buffer++ = palette[(bitmap_row[i / pixels_per_byte] >> (8 - bits_per_pixel * (i % pixels_per_byte + 1))) & index_mask];
+  if (bits_per_pixel == 4) {
+    for (; i + 2 <= px_end; i += 2) {
+      uint8_t currentByte = bitmap_row[i >> 1];
+      row_buffer[0] = palette[currentByte >> 4];
+      row_buffer[1] = palette[currentByte & 0x0F];
+      row_buffer += 2;
+    }
+  }
+  else {
+    for (; i + 4 <= px_end; i += 4) {
+      uint8_t currentByte = bitmap_row[i >> 2];
+      row_buffer[0] = palette[currentByte >> 6];
+      row_buffer[1] = palette[(currentByte >> 4) & 0x03];
+      row_buffer[2] = palette[(currentByte >> 2) & 0x03];
+      row_buffer[3] = palette[currentByte & 0x03];
+      row_buffer += 4;
+    }
+  }
+  for (; i < px_end; i++)
+    *row_buffer++ = palette[(bitmap_row[i / pixels_per_byte] >> (8 - bits_per_pixel * (i % pixels_per_byte + 1))) & index_mask];
+}
+
+// count one address window of pixels sent to display
+void RGBDisplay::CountBlit(uint32_t pixels) {
+  render_stats_.pixels += pixels;
+  render_stats_.addr_windows++;
+  render_stats_.bytes += DisplayTraits::kBytesPerPixel * pixels + DisplayTraits::kAddrWindowBytes;
+}
+
+// fill 16 entry nibble lookup table with 4 RGB565 pixels for every 4-bit bitmap pattern
+void RGBDisplay::BuildNibbleLut(uint16_t nibble_lut[16][4], uint16_t color, uint16_t bg) {
+  for (uint8_t nibble = 0; nibble < 16; nibble++)
+    for (uint8_t bit = 0; bit < 4; bit++)
+      nibble_lut[nibble][bit] = (((nibble >> (3 - bit)) & 0x01) ? color : bg);
+}
+
+/*!
+    @brief  Expand pixels [bit_start, bit_end) of one monochrome bitmap row into RGB565 colors.
+            A bit_start that is not byte aligned (left clipped bitmap) is handled bit by bit until
+            the next byte boundary, after which every bitmap byte is expanded with two nibble lookups.
+    @param  bitmap_row   Pointer to first byte of the bitmap row
+    @param  bit_start    First pixel of the row to expand
+    @param  bit_end      One past the last pixel of the row to expand
+    @param  row_buffer   Output buffer of at least (bit_end - bit_start) pixels
+    @param  nibble_lut   16 entry lookup table of 4 RGB565 pixels per nibble
+*/
+void RGBDisplay::ExpandTwoColorRow(const uint8_t* bitmap_row, int16_t bit_start, int16_t bit_end, uint16_t* row_buffer, const uint16_t nibble_lut[16][4]) {
+  int16_t i = bit_start;
+  // unaligned head, pixel by pixel up to the next byte boundary
+  if (i & 7) {
+    uint8_t currentByte = bitmap_row[i >> 3];
+    int16_t head_end = min(bit_end, (int16_t)((i | 7) + 1));
+    for (; i < head_end; i++)
+      *row_buffer++ = nibble_lut[((currentByte >> (7 - (i & 7))) & 0x01) ? 0x0F : 0x00][0];
+  }
+  // aligned body, 8 pixels per bitmap byte
+  for (; i + 8 <= bit_end; i += 8) {
+    uint8_t currentByte = bitmap_row[i >> 3];
+    memcpy(row_buffer, nibble_lut[currentByte >> 4], 4 * sizeof(uint16_t));
+    memcpy(row_buffer + 4, nibble_lut[currentByte & 0x0F], 4 * sizeof(uint16_t));
+    row_buffer += 8;
+  }
+  // tail, remaining pixels of the last partial byte
+  if (i < bit_end) {
+    uint8_t currentByte = bitmap_row[i >> 3];
+    for (; i < bit_end; i++)
+      *row_buffer++ = nibble_lut[((currentByte >> (7 - (i & 7))) & 0x01) ? 0x0F : 0x00][0];
+  }
+}
+
+/*!
+    @brief  Redraw screensaver canvas moved from frame memory position (old_x, old_y) to (new_x, new_y)
+            by sending only the pixels that change. Screen outside lit canvas pixels is always background,
+            so changed pixels are lit pixels at the old position XOR lit pixels at the new position.
+            Changed pixels of each screen row are grouped into spans, spans closer than
+            kScreensaverDeltaMergeGapPx are merged, and each span is sent as its own 1 row address window.
+            Canvas contents and color must be the same as what was drawn at the old position.
+*/
+void RGBDisplay::ScreensaverDeltaDraw(int16_t old_x, int16_t old_y, int16_t new_x, int16_t new_y, uint16_t color, uint16_t bg) {
+  // union of old and new canvas rectangles, clipped to screen
+  int16_t ux0 = max((int16_t)0, min(old_x, new_x));
+  int16_t uy0 = max((int16_t)0, min(old_y, new_y));
+  int16_t ux1 = min((int16_t)kTftWidth, (int16_t)(max(old_x, new_x) + screensaver_w_));
+  int16_t uy1 = min((int16_t)kTftHeight, (int16_t)(max(old_y, new_y) + screensaver_h_));
+  if (ux0 >= ux1 || uy0 >= uy1)
+    return;
+  int16_t union_w = ux1 - ux0;
+  int16_t union_bytes = (union_w + 7) >> 3;
+
+  uint16_t nibble_lut[16][4];
+  BuildNibbleLut(nibble_lut, color, bg);
+
+  uint8_t old_bits[(kTftWidth + 7) / 8], new_bits[(kTftWidth + 7) / 8];
+  uint16_t buffer16Bit[kTftWidth];
+
+  tft.startWrite();
+  for (int16_t y = uy0; y < uy1; y++) {
+    screensaver_sprites_.ComposeRowBits(y - old_y, old_x - ux0, old_bits, union_w);
+    screensaver_sprites_.ComposeRowBits(y - new_y, new_x - ux0, new_bits, union_w);
+
+    // walk changed pixels of this row, sending merged spans of new pixel colors
+    int16_t span_start = -1, span_end = -1;
+    for (int16_t b = 0; b < union_bytes; b++) {
+      uint8_t diff = old_bits[b] ^ new_bits[b];
+      if (!diff)
+        continue;
+      for (uint8_t bit = 0; bit < 8; bit++) {
+        if (!((diff >> (7 - bit)) & 0x01))
+          continue;
+        int16_t px = (b << 3) + bit;
+        if (px >= union_w)
+          break;
+        if (span_start >= 0 && px - span_end > kScreensaverDeltaMergeGapPx) {
+          ScreensaverDeltaSendSpan(new_bits, span_start, span_end, ux0, y, nibble_lut, buffer16Bit);
+          span_start = -1;
+        }
+        if (span_start < 0)
+          span_start = px;
+        span_end = px + 1;
+      }
     }
-    tft.writePixels(buffer16Bit, w);
+    if (span_start >= 0)
+      ScreensaverDeltaSendSpan(new_bits, span_start, span_end, ux0, y, nibble_lut, buffer16Bit);
   }
   tft.endWrite();
-  // Serial.print(" fastDrawBitmapTime "); Serial.print(charSpace); Serial.println(timer1);
+}
+
+// send pixels [span_start, span_end) of a screensaver bit row as a 1 row address window starting at screen x0 + span_start
+void RGBDisplay::ScreensaverDeltaSendSpan(const uint8_t* new_bits, int16_t span_start, int16_t span_end, int16_t x0, int16_t y, const uint16_t nibble_lut[16][4], uint16_t* row_buffer) {
+  int16_t span_w = span_end - span_start;
+  ExpandTwoColorRow(new_bits, span_start, span_end, row_buffer, nibble_lut);
+  tft.setAddrWindow(x0 + span_start, y, span_w, 1);
+  DisplayRowPusher::Push(tft, row_buffer, span_w);
+  CountBlit(span_w);
 }
 
 void RGBDisplay::SetAlarmScreen(bool processUserInput, bool inc_button_pressed, bool dec_button_pressed, bool push_button_pressed) {
@@ -465,20 +729,20 @@ void RGBDisplay::DisplayCursorHighlight(DisplayButton* button, bool highlight_On
     // inside WiFi Scan Networks Page List
     int cursorY = kWiFiScanNetworksList_y0_ - 0.75 * kWiFiScanNetworksList_h_ + 1 + (kWiFiScanNetworksList_h_ * current_wifi_networks_scan_page_cursor);
     if(highlight_On) {
-      tft.drawRoundRect(0, cursorY, kTftWidth - 1, kWiFiScanNetworksList_h_, kRadiusButtonRoundRect, kDisplayColorCyan);
+      gfx_->drawRoundRect(0, cursorY, kTftWidth - 1, kWiFiScanNetworksList_h_, kRadiusButtonRoundRect, kDisplayColorCyan);
     }
     else {
-      tft.drawRoundRect(0, cursorY, kTftWidth - 1, kWiFiScanNetworksList_h_, kRadiusButtonRoundRect, kDisplayBackroundColor);
+      gfx_->drawRoundRect(0, cursorY, kTftWidth - 1, kWiFiScanNetworksList_h_, kRadiusButtonRoundRect, kDisplayBackroundColor);
     }
   }
   else {
     if(highlight_On) {
-      tft.drawRoundRect(button->btn_x - 1, button->btn_y - 1, button->btn_w + 2 * 1, button->btn_h + 2 * 1, kRadiusButtonRoundRect, kDisplayColorCyan);
-      tft.drawRoundRect(button->btn_x - 2, button->btn_y - 2, button->btn_w + 2 * 2, button->btn_h + 2 * 2, kRadiusButtonRoundRect, kDisplayColorCyan);
+      gfx_->drawRoundRect(button->btn_x - 1, button->btn_y - 1, button->btn_w + 2 * 1, button->btn_h + 2 * 1, kRadiusButtonRoundRect, kDisplayColorCyan);
+      gfx_->drawRoundRect(button->btn_x - 2, button->btn_y - 2, button->btn_w + 2 * 2, button->btn_h + 2 * 2, kRadiusButtonRoundRect, kDisplayColorCyan);
     }
     else {
-      tft.drawRoundRect(button->btn_x - 1, button->btn_y - 1, button->btn_w + 2 * 1, button->btn_h + 2 * 1, kRadiusButtonRoundRect, kDisplayBackroundColor);
-      tft.drawRoundRect(button->btn_x - 2, button->btn_y - 2, button->btn_w + 2 * 2, button->btn_h + 2 * 2, kRadiusButtonRoundRect, kDisplayBackroundColor);
+      gfx_->drawRoundRect(button->btn_x - 1, button->btn_y - 1, button->btn_w + 2 * 1, button->btn_h + 2 * 1, kRadiusButtonRoundRect, kDisplayBackroundColor);
+      gfx_->drawRoundRect(button->btn_x - 2, button->btn_y - 2, button->btn_w + 2 * 2, button->btn_h + 2 * 2, kRadiusButtonRoundRect, kDisplayBackroundColor);
     }
   }
 }
@@ -493,6 +757,11 @@ void RGBDisplay::DisplayCursorHighlight(bool highlight_On) {
   }
 }
 
+/*!
+    @brief  Draw row of current page holding button. A row that is on display since the last page
+            draw and whose label layout is unchanged redraws only its button, and nothing at all if
+            the button's value and on state are also unchanged.
+*/
 void RGBDisplay::DisplayCurrentPageButtonRow(DisplayButton* button, int button_index, bool is_on) {
 
   // exclude special case: (current_page == kWiFiScanNetworksPage) && (current_cursor == kWiFiScanNetworksPageList) -> these list items are just label
@@ -500,95 +769,84 @@ void RGBDisplay::DisplayCurrentPageButtonRow(DisplayButton* button, int button_i
 
     const int row_text_y0 = (button_index + 1) * kPageRowHeight + 20;
 
+    // button rect on display before this draw
+    int16_t old_x = button->btn_x, old_y = button->btn_y;
+    uint16_t old_w = button->btn_w, old_h = button->btn_h;
+    bool row_on_display = (gfx_ == &tft && button->drawn_generation == drawn_rows_generation_);
+
+    if(button->btn_type != kClickButtonWithIcon)
+      LayoutRowButton(button, row_text_y0);
+
+    // label fits in 1 row if it fits left of button
+    int space_left = (button->btn_type != kClickButtonWithIcon ? button->btn_x - kDisplayTextGap : kTftWidth);
+    if(button->row_label.size() > 0 && button->label_w == 0) {
+      int16_t row_label_x0, row_label_y0;
+      uint16_t row_label_h;
+      gfx_->setFont(&FreeMono9pt7b);
+      gfx_->getTextBounds(button->row_label.c_str(), 0, row_text_y0, &row_label_x0, &row_label_y0, &button->label_w, &row_label_h);
+    }
+    bool label_one_row = (button->row_label.size() == 0 || button->label_w + kDisplayTextGap <= space_left);
+
+    if(row_on_display && label_one_row && button->label_one_row && button->btn_type != kClickButtonWithIcon) {
+      if(button->drawn_value == button->btn_value && button->drawn_is_on == is_on)
+        return;
+      // only button changed, redraw old and new button rects with their highlight ring
+      int16_t x1 = min(old_x, button->btn_x) - 2, y1 = min(old_y, button->btn_y) - 2;
+      int16_t x2 = max(old_x + old_w, button->btn_x + button->btn_w) + 2, y2 = max(old_y + old_h, button->btn_y + button->btn_h) + 2;
+      display_list_.Begin(x1, y1, x2 - x1, y2 - y1, kDisplayBackroundColor);
+      gfx_ = &display_list_;
+      DrawRowButton(button, row_text_y0, is_on);
+      DisplayCursorHighlight(button, button->btn_cursor_id == current_cursor);
+      gfx_ = &tft;
+      if(display_list_.overflowed()) {
+        PrintLn("Display list overflowed on button of page ", current_page);
+        tft.fillRect(x1, y1, x2 - x1, y2 - y1, kDisplayBackroundColor);
+        DrawRowButton(button, row_text_y0, is_on);
+        DisplayCursorHighlight(button, button->btn_cursor_id == current_cursor);
+        return;
+      }
+      FlushDisplayList();
+      return;
+    }
+
     // clear row if item has label
     if(button->row_label.size() > 0)
-      tft.fillRect(0, row_text_y0 - 20, kTftWidth, kPageRowHeight, kDisplayBackroundColor);
-
-    int space_left = kTftWidth;
+      gfx_->fillRect(0, row_text_y0 - 20, kTftWidth, kPageRowHeight, kDisplayBackroundColor);
 
     // First Row Item's Button is drawn, then Row Item's Label is drawn
 
     // item button
-
-    // if not an icon button then make a button
-    if(button->btn_type != kClickButtonWithIcon) {
-      if(button->fixed_location) {
-        // pre-fixed location button
-        tft.setFont(&FreeMonoBold9pt7b);
-        tft.setTextColor(kDisplayColorBlack);
-        // make button
-        tft.fillRoundRect(button->btn_x, button->btn_y, button->btn_w, button->btn_h, kRadiusButtonRoundRect, (is_on ? kButtonClickedFillColor : kButtonFillColor));
-        tft.drawRoundRect(button->btn_x, button->btn_y, button->btn_w, button->btn_h, kRadiusButtonRoundRect, kButtonBorderColor);
-        int16_t btn_value_x0 = button->btn_x + kDisplayTextGap, btn_value_y0 = button->btn_y + button->btn_h - kDisplayTextGap;
-        tft.setCursor(btn_value_x0, btn_value_y0);
-        tft.print(button->btn_value.c_str());
-      }
-      else {
-        // button location to be calculated at runtime
-        tft.setFont(&FreeMonoBold9pt7b);
-        tft.setTextColor(kDisplayColorBlack);
-        int16_t btn_value_x0 = 0, btn_value_y0 = row_text_y0;
-        uint16_t btn_value_w, btn_value_h;
-        tft.setCursor(btn_value_x0, row_text_y0);
-        // get bounds of title on tft display (with background color as this causes a blink)
-        tft.getTextBounds(button->btn_value.c_str(), btn_value_x0, btn_value_y0, &btn_value_x0, &btn_value_y0, &btn_value_w, &btn_value_h);
-        // Serial.printf("btn_value_x0 %d, btn_value_y0 %d, btn_value_w %d, btn_value_h %d\n", btn_value_x0, btn_value_y0, btn_value_w, btn_value_h);
-        // calculate size
-        button->btn_x = kTftWidth - btn_value_w - 3 * kDisplayTextGap;
-        button->btn_y = row_text_y0 - btn_value_h - kDisplayTextGap;
-        button->btn_w = btn_value_w + 2 * kDisplayTextGap;
-        button->btn_h = btn_value_h + 2 * kDisplayTextGap;
-        // Serial.printf("flexible button->btn_x %d, button->btn_y %d, button->btn_w %d, button->btn_h %d\n", button->btn_x, button->btn_y, button->btn_w, button->btn_h);
-        // make button
-        if(button->btn_type == kLabelOnlyNoClickButton) {
-          // special case -> only label, no click button
-          tft.setTextColor(kDisplayColorGreen);
-          button->btn_x = button->btn_x + 2 * kDisplayTextGap;
-          tft.setCursor(button->btn_x, row_text_y0);
-          tft.print(button->btn_value.c_str());
-        }
-        else {
-          tft.fillRoundRect(button->btn_x, button->btn_y, button->btn_w, button->btn_h, kRadiusButtonRoundRect, (is_on ? kButtonClickedFillColor : kButtonFillColor));
-          tft.drawRoundRect(button->btn_x, button->btn_y, button->btn_w, button->btn_h, kRadiusButtonRoundRect, kButtonBorderColor);
-          tft.setCursor(button->btn_x + kDisplayTextGap, row_text_y0);
-          tft.print(button->btn_value.c_str());
-        }
-      }
-
-      space_left = button->btn_x - kDisplayTextGap;
-    }
+    if(button->btn_type != kClickButtonWithIcon)
+      DrawRowButton(button, row_text_y0, is_on);
 
     // item label
 
     if(button->row_label.size() > 0) {
-      tft.setFont(&FreeMono9pt7b);
-      tft.setTextColor(kDisplayColorBlack);
-      int16_t row_label_x0 = 0, row_label_y0 = row_text_y0;
-      uint16_t row_label_w, row_label_h;
-      tft.setCursor(row_label_x0, row_text_y0);
-      // get bounds of title on tft display (with background color as this causes a blink)
-      tft.getTextBounds(button->row_label.c_str(), row_label_x0, row_label_y0, &row_label_x0, &row_label_y0, &row_label_w, &row_label_h);
-      // Serial.printf("row_label_x0 %d, row_label_y0 %d, row_label_w %d, row_label_h %d\n", row_label_x0, row_label_y0, row_label_w, row_label_h);
+      gfx_->setFont(&FreeMono9pt7b);
       // check width and fit in 1 or 2 rows
-      if(row_label_w + kDisplayTextGap <= space_left) {
+      if(label_one_row) {
         // label fits in 1 row
-        tft.setTextColor(kDisplayColorYellow);
-        tft.setCursor(kDisplayTextGap, row_text_y0);
-        tft.print(button->row_label.c_str());
+        gfx_->setTextColor(kDisplayColorYellow);
+        gfx_->setCursor(kDisplayTextGap, row_text_y0);
+        gfx_->print(button->row_label.c_str());
       }
       else {
         // we give label 2 rows
-        tft.setTextColor(kDisplayColorYellow);
+        gfx_->setTextColor(kDisplayColorYellow);
         // row 1
-        tft.setCursor(kDisplayTextGap, row_text_y0 - 10);
+        gfx_->setCursor(kDisplayTextGap, row_text_y0 - 10);
         int row_1_label_length = button->row_label.size() / 2;
         std::string row_1_label = button->row_label.substr(0, row_1_label_length);
-        tft.print(row_1_label.c_str());
-        tft.setCursor(kDisplayTextGap, row_text_y0 + 5);
+        gfx_->print(row_1_label.c_str());
+        gfx_->setCursor(kDisplayTextGap, row_text_y0 + 5);
         std::string row_2_label = button->row_label.substr(row_1_label_length, button->row_label.size() - row_1_label_length);
-        tft.print(row_2_label.c_str());
+        gfx_->print(row_2_label.c_str());
       }
     }
+    button->label_one_row = label_one_row;
+    button->drawn_generation = drawn_rows_generation_;
+    if(gfx_ == &tft)
+      page_rows_drawn_++;
   }
 
   // button highlight
@@ -598,6 +856,56 @@ void RGBDisplay::DisplayCurrentPageButtonRow(DisplayButton* button, int button_i
     DisplayCursorHighlight(button, false);
 }
 
+// set rect of a button whose location is calculated at runtime from its value text bounds,
+// text bounds are measured only when value changed since last draw
+void RGBDisplay::LayoutRowButton(DisplayButton* button, int row_text_y0) {
+  if(button->fixed_location)
+    return;
+  if(button->drawn_value != button->btn_value || button->value_h == 0) {
+    int16_t btn_value_x0 = 0, btn_value_y0 = row_text_y0;
+    gfx_->setFont(&FreeMonoBold9pt7b);
+    // get bounds of title on tft display (with background color as this causes a blink)
+    gfx_->getTextBounds(button->btn_value.c_str(), btn_value_x0, btn_value_y0, &btn_value_x0, &btn_value_y0, &button->value_w, &button->value_h);
+    // Serial.printf("btn_value_x0 %d, btn_value_y0 %d, btn_value_w %d, btn_value_h %d\n", btn_value_x0, btn_value_y0, button->value_w, button->value_h);
+  }
+  // calculate size
+  button->btn_x = kTftWidth - button->value_w - 3 * kDisplayTextGap;
+  button->btn_y = row_text_y0 - button->value_h - kDisplayTextGap;
+  button->btn_w = button->value_w + 2 * kDisplayTextGap;
+  button->btn_h = button->value_h + 2 * kDisplayTextGap;
+  // special case -> only label, no click button
+  if(button->btn_type == kLabelOnlyNoClickButton)
+    button->btn_x = button->btn_x + 2 * kDisplayTextGap;
+  // Serial.printf("flexible button->btn_x %d, button->btn_y %d, button->btn_w %d, button->btn_h %d\n", button->btn_x, button->btn_y, button->btn_w, button->btn_h);
+}
+
+// draw button of a page row at its laid out rect
+void RGBDisplay::DrawRowButton(DisplayButton* button, int row_text_y0, bool is_on) {
+  gfx_->setFont(&FreeMonoBold9pt7b);
+  gfx_->setTextColor(kDisplayColorBlack);
+  if(button->fixed_location) {
+    // pre-fixed location button
+    gfx_->fillRoundRect(button->btn_x, button->btn_y, button->btn_w, button->btn_h, kRadiusButtonRoundRect, (is_on ? kButtonClickedFillColor : kButtonFillColor));
+    gfx_->drawRoundRect(button->btn_x, button->btn_y, button->btn_w, button->btn_h, kRadiusButtonRoundRect, kButtonBorderColor);
+    int16_t btn_value_x0 = button->btn_x + kDisplayTextGap, btn_value_y0 = button->btn_y + button->btn_h - kDisplayTextGap;
+    gfx_->setCursor(btn_value_x0, btn_value_y0);
+    gfx_->print(button->btn_value.c_str());
+  }
+  else if(button->btn_type == kLabelOnlyNoClickButton) {
+    gfx_->setTextColor(kDisplayColorGreen);
+    gfx_->setCursor(button->btn_x, row_text_y0);
+    gfx_->print(button->btn_value.c_str());
+  }
+  else {
+    gfx_->fillRoundRect(button->btn_x, button->btn_y, button->btn_w, button->btn_h, kRadiusButtonRoundRect, (is_on ? kButtonClickedFillColor : kButtonFillColor));
+    gfx_->drawRoundRect(button->btn_x, button->btn_y, button->btn_w, button->btn_h, kRadiusButtonRoundRect, kButtonBorderColor);
+    gfx_->setCursor(button->btn_x + kDisplayTextGap, row_text_y0);
+    gfx_->print(button->btn_value.c_str());
+  }
+  button->drawn_value = button->btn_value;
+  button->drawn_is_on = is_on;
+}
+
 void RGBDisplay::DisplayCurrentPageButtonRow(int button_index, bool is_on) {
   DisplayButton* button = display_pages_vec[current_page][button_index];
   DisplayCurrentPageButtonRow(button, button_index, is_on);
@@ -613,13 +921,64 @@ void RGBDisplay::DisplayCurrentPageButtonRow(bool is_on) {
   }
 }
 
+/*!
+    @brief  Compose current settings page in display list and send it to display in one
+            transaction, falls back to drawing directly if page does not fit in display list.
+*/
 void RGBDisplay::DisplayCurrentPage() {
-  tft.fillScreen(kDisplayBackroundColor);
+  InvalidateDrawnRows();
+  display_list_.Begin(0, 0, kTftWidth, kTftHeight, kDisplayBackroundColor);
+  gfx_ = &display_list_;
+  DrawCurrentPage();
+  gfx_ = &tft;
+  if(display_list_.overflowed()) {
+    PrintLn("Display list overflowed on page ", current_page);
+    // rows were marked drawn while recording, none of them reached the display
+    InvalidateDrawnRows();
+    DrawCurrentPage();
+    return;
+  }
+  FlushDisplayList();
+  if(debug_mode) {
+    PrintLn("DisplayList recorded: ", display_list_.recorded_count_);
+    PrintLn("DisplayList dropped: ", display_list_.dropped_count_);
+    PrintLn("DisplayList culled: ", display_list_.culled_count_);
+    PrintLn("DisplayList peak commands: ", display_list_.peak_command_count_);
+  }
+}
+
+// screen is being redrawn, rows drawn before are no longer on display
+void RGBDisplay::InvalidateDrawnRows() {
+  if(++drawn_rows_generation_ == 0)
+    drawn_rows_generation_ = 1;
+}
+
+// send composed display list to display as one address window, one band at a time
+void RGBDisplay::FlushDisplayList() {
+  display_list_.Finish();
+  int16_t x = display_list_.window_x(), y = display_list_.window_y();
+  int16_t w = display_list_.window_w(), h = display_list_.window_h();
+  if(w <= 0 || h <= 0)
+    return;
+  tft.startWrite();
+  tft.setAddrWindow(x, y, w, h);
+  for(int16_t band_y = y; band_y < y + h; band_y += DisplayList::kBandRows) {
+    int16_t rows = min((int16_t)DisplayList::kBandRows, (int16_t)(y + h - band_y));
+    uint16_t* band = DisplayList::band_buffer_;
+    display_list_.RenderBand(band_y, rows, band);
+    DisplayRowPusher::Push(tft, band, w * rows);
+  }
+  tft.endWrite();
+  CountBlit(w * h);
+}
+
+void RGBDisplay::DrawCurrentPage() {
+  gfx_->fillScreen(kDisplayBackroundColor);
 
   // Page Title
-  tft.setFont(&FreeMonoBold9pt7b);
-  tft.setTextColor(kDisplayColorGreen);
-  tft.setCursor(kDisplayTextGap, 20);
+  gfx_->setFont(&FreeMonoBold9pt7b);
+  gfx_->setTextColor(kDisplayColorGreen);
+  gfx_->setCursor(kDisplayTextGap, 20);
   std::string title_str = "";
   switch(current_page) {
     case kScreensaverSettingsPage: title_str = "SCREENSAVER SETTINGS PAGE"; break;
@@ -628,7 +987,7 @@ void RGBDisplay::DisplayCurrentPage() {
     case kLocationAndWeatherSettingsPage: title_str = "LOCATION & WEATHER SETTINGS"; break;
     default: title_str = "Not Implemented!";
   }
-  tft.print(title_str.c_str());
+  gfx_->print(title_str.c_str());
 
   // Page Body
   for (int i = 0; i < display_pages_vec[current_page].size(); i++) {
@@ -655,53 +1014,53 @@ void RGBDisplay::DisplayBlankScreen() {
 
 void RGBDisplay::DisplayWiFiConnectionStatus() {
   // clear any old text
-  tft.setFont(&FreeSans12pt7b);
-  tft.setTextColor(kDisplayBackroundColor);
-  tft.setCursor(kDisplayTextGap, 190);
-  tft.print("WiFi Connected!");
-
-  tft.setFont(&FreeMono9pt7b);
-  tft.setCursor(kDisplayTextGap, 170);
-  tft.print("Could not");
-  tft.setCursor(kDisplayTextGap, 190);
-  tft.print("connect to saved");
-  tft.setCursor(kDisplayTextGap, 210);
-  tft.print("WiFi Network.");
+  gfx_->setFont(&FreeSans12pt7b);
+  gfx_->setTextColor(kDisplayBackroundColor);
+  gfx_->setCursor(kDisplayTextGap, 190);
+  gfx_->print("WiFi Connected!");
+
+  gfx_->setFont(&FreeMono9pt7b);
+  gfx_->setCursor(kDisplayTextGap, 170);
+  gfx_->print("Could not");
+  gfx_->setCursor(kDisplayTextGap, 190);
+  gfx_->print("connect to saved");
+  gfx_->setCursor(kDisplayTextGap, 210);
+  gfx_->print("WiFi Network.");
 
   // write new text
   if(wifi_stuff->wifi_connected_) {
-    tft.setFont(&FreeSans12pt7b);
-    tft.setTextColor(kDisplayColorBlue);
-    tft.setCursor(kDisplayTextGap, 190);
-    tft.print("WiFi Connected!");
+    gfx_->setFont(&FreeSans12pt7b);
+    gfx_->setTextColor(kDisplayColorBlue);
+    gfx_->setCursor(kDisplayTextGap, 190);
+    gfx_->print("WiFi Connected!");
   }
   else {
-    tft.setFont(&FreeMono9pt7b);
-    tft.setTextColor(kDisplayColorBlue);
-    tft.setCursor(kDisplayTextGap, 170);
-    tft.print("Could not");
-    tft.setCursor(kDisplayTextGap, 190);
-    tft.print("connect to saved");
-    tft.setCursor(kDisplayTextGap, 210);
-    tft.print("WiFi Network.");
+    gfx_->setFont(&FreeMono9pt7b);
+    gfx_->setTextColor(kDisplayColorBlue);
+    gfx_->setCursor(kDisplayTextGap, 170);
+    gfx_->print("Could not");
+    gfx_->setCursor(kDisplayTextGap, 190);
+    gfx_->print("connect to saved");
+    gfx_->setCursor(kDisplayTextGap, 210);
+    gfx_->print("WiFi Network.");
   }
 }
 
 void RGBDisplay::DisplayFirmwareVersionAndDate() {
   // Firmware Version and Date
-  tft.setFont(&FreeMono9pt7b);
-  tft.setTextColor(kDisplayColorBlue);
-  tft.setCursor(10, kTftHeight - 20);
-  tft.print("Firmware: ");
-  tft.print(kFirmwareVersion.c_str());
+  gfx_->setFont(&FreeMono9pt7b);
+  gfx_->setTextColor(kDisplayColorBlue);
+  gfx_->setCursor(10, kTftHeight - 20);
+  gfx_->print("Firmware: ");
+  gfx_->print(kFirmwareVersion.c_str());
   if(wifi_stuff->firmware_update_available_str_.size() > 0) {
-    tft.setFont(&FreeMonoBold9pt7b);
-    tft.print(" (latest)");
-    tft.setFont(&FreeMono9pt7b);
+    gfx_->setFont(&FreeMonoBold9pt7b);
+    gfx_->print(" (latest)");
+    gfx_->setFont(&FreeMono9pt7b);
   }
-  tft.setCursor(10, kTftHeight - 5);
-  tft.print("Date: ");
-  tft.print(kFirmwareDate.c_str());
+  gfx_->setCursor(10, kTftHeight - 5);
+  gfx_->print("Date: ");
+  gfx_->print(kFirmwareDate.c_str());
 }
 
 Cursor RGBDisplay::CheckButtonTouch() {
@@ -914,59 +1273,59 @@ void RGBDisplay::DisplayWeatherInfo() {
 
   // show today's weather
   if(wifi_stuff->got_weather_info_) {
-    // tft.setFont(&FreeMonoBold9pt7b);
+    // gfx_->setFont(&FreeMonoBold9pt7b);
     if(current_page == kLocationAndWeatherSettingsPage) {
-      tft.setFont(&FreeMonoBold9pt7b);
-      tft.setCursor(60, 50);
-      tft.setTextColor(kDisplayColorGreen);
-      tft.print(wifi_stuff->city_.c_str());
-      tft.setTextColor(kDisplayColorBlue);
+      gfx_->setFont(&FreeMonoBold9pt7b);
+      gfx_->setCursor(60, 50);
+      gfx_->setTextColor(kDisplayColorGreen);
+      gfx_->print(wifi_stuff->city_.c_str());
+      gfx_->setTextColor(kDisplayColorBlue);
     }
     else {
-      tft.setFont(&FreeSans12pt7b);
-      tft.setCursor(city_x0, city_y0);
-      tft.setTextColor(kDisplayColorOrange);
-      tft.print(wifi_stuff->city_.c_str());
+      gfx_->setFont(&FreeSans12pt7b);
+      gfx_->setCursor(city_x0, city_y0);
+      gfx_->setTextColor(kDisplayColorOrange);
+      gfx_->print(wifi_stuff->city_.c_str());
     }
-    tft.setFont(&FreeSans12pt7b);
-    tft.setCursor(weather_x0, weather_main_y0);
-    tft.print(wifi_stuff->weather_main_.c_str()); tft.print(" : "); tft.print(wifi_stuff->weather_description_.c_str());
-    tft.setFont(&FreeMono9pt7b);
-    tft.setCursor(weather_x0, weather_row2_y0);
-    tft.print("Temp: "); tft.print(wifi_stuff->weather_temp_.c_str()); tft.print("  Feels: "); tft.print(wifi_stuff->weather_temp_feels_like_.c_str());
-    tft.setCursor(weather_x0, weather_row3_y0);
-    tft.print("Max : "); tft.print(wifi_stuff->weather_temp_max_.c_str()); tft.print("  Min: "); tft.print(wifi_stuff->weather_temp_min_.c_str());
-    tft.setCursor(weather_x0, weather_row4_y0);
-    tft.print("Wind: "); tft.print(wifi_stuff->weather_wind_speed_.c_str()); tft.print(" Humidity: "); tft.print(wifi_stuff->weather_humidity_.c_str());
+    gfx_->setFont(&FreeSans12pt7b);
+    gfx_->setCursor(weather_x0, weather_main_y0);
+    gfx_->print(wifi_stuff->weather_main_.c_str()); gfx_->print(" : "); gfx_->print(wifi_stuff->weather_description_.c_str());
+    gfx_->setFont(&FreeMono9pt7b);
+    gfx_->setCursor(weather_x0, weather_row2_y0);
+    gfx_->print("Temp: "); gfx_->print(wifi_stuff->weather_temp_.c_str()); gfx_->print("  Feels: "); gfx_->print(wifi_stuff->weather_temp_feels_like_.c_str());
+    gfx_->setCursor(weather_x0, weather_row3_y0);
+    gfx_->print("Max : "); gfx_->print(wifi_stuff->weather_temp_max_.c_str()); gfx_->print("  Min: "); gfx_->print(wifi_stuff->weather_temp_min_.c_str());
+    gfx_->setCursor(weather_x0, weather_row4_y0);
+    gfx_->print("Wind: "); gfx_->print(wifi_stuff->weather_wind_speed_.c_str()); gfx_->print(" Humidity: "); gfx_->print(wifi_stuff->weather_humidity_.c_str());
   }
   else {
-    tft.setTextColor(kDisplayColorBlue);
-    tft.setFont(&FreeMono9pt7b);
+    gfx_->setTextColor(kDisplayColorBlue);
+    gfx_->setFont(&FreeMono9pt7b);
     if(wifi_stuff->openWeatherMapApiKey.size() == 0) {
-      tft.setCursor(weather_x0, weather_row2_y0);
-      tft.print("Cannot fetch/update time.");
-      tft.setCursor(weather_x0, weather_row3_y0);
-      tft.print("OpenWeatherMapApiKey empty!");
+      gfx_->setCursor(weather_x0, weather_row2_y0);
+      gfx_->print("Cannot fetch/update time.");
+      gfx_->setCursor(weather_x0, weather_row3_y0);
+      gfx_->print("OpenWeatherMapApiKey empty!");
     }
     else if(wifi_stuff->get_weather_info_wait_seconds_ > 0) {
-      tft.setCursor(weather_x0, weather_row2_y0);
-      tft.print("Wait for ");
-      tft.print(wifi_stuff->get_weather_info_wait_seconds_);
-      tft.print(" seconds");
-      tft.setCursor(weather_x0, weather_row3_y0);
-      tft.print("before next Fetch.");
+      gfx_->setCursor(weather_x0, weather_row2_y0);
+      gfx_->print("Wait for ");
+      gfx_->print(wifi_stuff->get_weather_info_wait_seconds_);
+      gfx_->print(" seconds");
+      gfx_->setCursor(weather_x0, weather_row3_y0);
+      gfx_->print("before next Fetch.");
     }
     else if(wifi_stuff->incorrect_zip_code) {
-      tft.setCursor(weather_x0, weather_row2_y0);
-      tft.print("Incorrect");
-      tft.setCursor(weather_x0, weather_row3_y0);
-      tft.print("Location/ZIP!");
+      gfx_->setCursor(weather_x0, weather_row2_y0);
+      gfx_->print("Incorrect");
+      gfx_->setCursor(weather_x0, weather_row3_y0);
+      gfx_->print("Location/ZIP!");
     }
     else {
-      tft.setCursor(weather_x0, weather_row2_y0);
-      tft.print("Could not fetch");
-      tft.setCursor(weather_x0, weather_row3_y0);
-      tft.print("Weather info!");
+      gfx_->setCursor(weather_x0, weather_row2_y0);
+      gfx_->print("Could not fetch");
+      gfx_->setCursor(weather_x0, weather_row3_y0);
+      gfx_->print("Weather info!");
     }
   }
 }
@@ -1047,152 +1406,244 @@ void RGBDisplay::AlarmTriggeredScreen(bool firstTime, int8_t buttonPressSecondsC
   tft.print(timer_str);
 }
 
-void RGBDisplay::Screensaver() {
-  const int16_t GAP_BAND = 5;
+void RGBDisplay::Screensaver(uint16_t step_ms) {
+  bool canvas_rebuilt = refresh_screensaver_canvas_;
   if(refresh_screensaver_canvas_) {
     // map time
-    elapsedMillis timer1;
+    elapsedMicros timer1;
 
-    // delete created canvas and null the pointer
-    if(my_canvas_ != NULL) {
-      delete my_canvas_;
-      my_canvas_ = NULL;
-    }
-
-    // get bounds of HH:MM text on screen
-    tft.setFont(&ComingSoon_Regular70pt7b);
-    tft.setTextColor(kDisplayBackroundColor);
-    tft.getTextBounds(new_display_data_.time_HHMM, 0, 0, &gap_right_x_, &gap_up_y_, &tft_HHMM_w_, &tft_HHMM_h_);
-
-    // get bounds of date string
-    uint16_t date_h = 0, date_w = 0;
-    int16_t date_gap_x = 0, date_gap_y = 0;
-    if(rtc->hour() >= 10)
-      tft.setFont(&Satisfy_Regular24pt7b);
-    else
-      tft.setFont(&Satisfy_Regular18pt7b);
-    tft.getTextBounds(new_display_data_.date_str, 0, 0, &date_gap_x, &date_gap_y, &date_w, &date_h);
-    
-    int16_t date_x0 = GAP_BAND - date_gap_x;
-    int16_t alarm_icon_w = (new_display_data_.alarm_ON ? kBellSmallWidth : kBellFallenSmallWidth);
-    int16_t alarm_icon_h = (new_display_data_.alarm_ON ? kBellSmallHeight : kBellFallenSmallHeight);
-    uint16_t date_row_w = date_w + 2 * GAP_BAND + alarm_icon_w;
-    screensaver_w_ = max(tft_HHMM_w_ + 5 * GAP_BAND, date_row_w + 5 * GAP_BAND);
-    screensaver_h_ = tft_HHMM_h_ + max((int)date_h, (int)alarm_icon_h) + 4*GAP_BAND;
-    // middle both rows
-    tft_HHMM_x0_ = (screensaver_w_ - tft_HHMM_w_) / 2 - gap_right_x_;
-    date_x0 = (screensaver_w_ - date_row_w) / 2 - date_gap_x;
-    
-    // create canvas
-    my_canvas_ = new GFXcanvas1(screensaver_w_, screensaver_h_);
-
-    my_canvas_->setTextWrap(false);
-    my_canvas_->fillScreen(kDisplayBackroundColor);
+    // palette canvas is drawn whole each time, time, date and bell sprites only when their text changes
+    palette_canvas_ = NULL;
+    LayoutScreensaver();
 
     // picknew random color
     if(!new_minute_)  // pick new color only when time hits top or bottom row, not when a minute change is there
       PickNewRandomColor();
     else
       new_minute_ = false;
-    uint16_t randomColor = kColorPickerWheel[current_random_color_index_];
-
-    // print HH:MM
-    my_canvas_->setFont(&ComingSoon_Regular70pt7b);
-    my_canvas_->setTextColor(randomColor);
-    my_canvas_->setCursor(tft_HHMM_x0_ + GAP_BAND, GAP_BAND - gap_up_y_);
-    my_canvas_->print(new_display_data_.time_HHMM);
-
-    // print date string
-    if(rtc->hour() >= 10)
-      my_canvas_->setFont(&Satisfy_Regular24pt7b);
-    else
-      my_canvas_->setFont(&Satisfy_Regular18pt7b);
-    my_canvas_->setTextColor(randomColor);
-    my_canvas_->setCursor(date_x0 + GAP_BAND, screensaver_h_ - 5 * GAP_BAND);
 
-    if(!firmware_updated_flag_user_information) {
-      my_canvas_->print(new_display_data_.date_str);
-
-      // draw bell
-      my_canvas_->drawBitmap(my_canvas_->getCursorX() + 2*GAP_BAND, screensaver_h_ - alarm_icon_h - 3 * GAP_BAND, (new_display_data_.alarm_ON ? kBellSmallBitmap : kBellFallenSmallBitmap), alarm_icon_w, alarm_icon_h, randomColor);
-    }
-    else {
-      my_canvas_->setFont(&FreeMonoBold9pt7b);
-      // print firmware updated string
-      std::string fw_updated_str = "Firmware Updated " + kFirmwareVersion + "!";
-      my_canvas_->print(fw_updated_str.c_str());
-    }
-
-    // get visual bounds of created canvas and time string
-    // myCanvas->drawRect(tft_HHMM_x0 + GAP_BAND, GAP_BAND, tft_HHMM_w, tft_HHMM_h, Display_Color_Green);  // time border
-    // myCanvas->drawRect(date_x0 + GAP_BAND, screensaver_h + date_gap_y - 2 * GAP_BAND, date_row_w, date_h, Display_Color_Cyan);  // date row border
-    if(show_colored_edge_screensaver_)
-      my_canvas_->drawRect(0,0, screensaver_w_, screensaver_h_, kDisplayColorWhite);  // canvas border
-
-    if(rtc->year() < 2024) {
-      IncorrectTimeBanner();
-    }
+    // gradient takes the deepest palette canvas that fits, else one color sprites
+    bool palette_drawn = (screensaver_gradient_ && rtc->year() >= 2024 && DrawScreensaverPaletteCanvas());
+    if(!palette_drawn && !ComposeScreensaverSprites())
+      return;
 
     // stop refreshing canvas until time change or if it hits top or bottom screen edges
     refresh_screensaver_canvas_ = false;
 
     if(debug_mode) {
       unsigned long time1 = timer1;
-      // Serial.printf("Screensave re-canvas time: %lums\n", time1);
-      PrintLn("Screensave re-canvas time (ms): ", time1);
+      // Serial.printf("Screensave re-canvas time: %luus\n", time1);
+      PrintLn("Screensave re-canvas time (us): ", time1);
     }
   }
   else {
 
-    // move the time text on screen
-    const int16_t adder = 1;
-    screensaver_x1_ += (screensaver_move_right_ ? adder : -adder);
-    screensaver_y1_ += (screensaver_move_down_ ? adder : -adder);
-
-    // set direction on hitting any edge
-    // left and right edge - only change direction
-    if(screensaver_x1_ + 2* GAP_BAND <= 0) {   // left edge
-      if(!screensaver_move_right_) {
-        screensaver_move_right_ = true;
-        // if(rtc->hour() < 10)
-        //   refresh_screensaver_canvas_ = true;
-      }
-    }
-    else if(screensaver_x1_ + screensaver_w_ - 2 * GAP_BAND >= kTftWidth) {    // right edge
-      if(screensaver_bounce_not_fly_horizontally_) {
-        if(screensaver_move_right_) {
-          screensaver_move_right_ = false;
-          // if(rtc->hour() < 10)
-          //   refresh_screensaver_canvas_ = true;
-        }
-      }
-      else {  // fly through right edge and apprear back on left edge
-        if(screensaver_x1_ > kTftWidth)
-          screensaver_x1_ = - kTftWidth;
-      }
-    }
+    // move the time text on screen by time since last move, frame rate does not change speed
+    unsigned long now = millis();
+    if(step_ms == 0)
+      step_ms = min(now - screensaver_step_millis_, (unsigned long)UINT16_MAX);
+    screensaver_step_millis_ = now;
+
+    screensaver_motion_.SetTrajectory(screensaver_lissajous_ ? kScreensaverLissajous : (screensaver_bounce_not_fly_horizontally_ ? kScreensaverBounce : kScreensaverFlyThrough));
+    // edges are hit when the gap band around canvas contents is off screen
+    screensaver_motion_.SetBounds(- 2 * kScreensaverGapBand, kTftWidth - screensaver_w_ + 2 * kScreensaverGapBand, - kScreensaverGapBand, kTftHeight - screensaver_h_ + kScreensaverGapBand);
+    if(SupportsHardwareScroll())
+      screensaver_motion_.SetFlyWrap(kTftWidth, kTftWidth);    // scrolled frame memory wraps around, keep position continuous
+    else
+      screensaver_motion_.SetFlyWrap(kTftWidth + 1, 2 * kTftWidth);
+
     // top and bottom edge - when hit change color as well
-    if(screensaver_y1_ + GAP_BAND <= 0)  {   // top edge
-      if(!screensaver_move_down_) {
-        screensaver_move_down_ = true;
-        refresh_screensaver_canvas_ = true;
-      }
-    }
-    else if(screensaver_y1_ + screensaver_h_ - GAP_BAND >= kTftHeight)  {   // bottom edge
-      if(screensaver_move_down_) {
-        screensaver_move_down_ = false;
-        refresh_screensaver_canvas_ = true;
-      }
-    }
+    if(screensaver_motion_.Step(step_ms))
+      refresh_screensaver_canvas_ = true;
+    screensaver_x1_ = screensaver_motion_.x();
+    screensaver_y1_ = screensaver_motion_.y();
   }
 
   // paste the canvas on screen
   // tft.drawRGBBitmap(screensaver_x1, screensaver_y1, myCanvas->getBuffer(), screensaver_w, screensaver_h); // Copy to screen
   // tft.drawBitmap(screensaver_x1, screensaver_y1, myCanvas->getBuffer(), screensaver_w, screensaver_h, colorPickerWheelBright[currentRandomColorIndex], Display_Backround_Color); // Copy to screen
-  FastDrawTwoColorBitmapSpi(screensaver_x1_, screensaver_y1_, my_canvas_->getBuffer(), screensaver_w_, screensaver_h_, kColorPickerWheel[current_random_color_index_], kDisplayBackroundColor);
+  // with hardware scroll, canvas stays at frame memory x = 0 and horizontal motion is the scroll offset
+  int16_t frame_x1 = (SupportsHardwareScroll() ? 0 : screensaver_x1_);
+  if(palette_canvas_ != NULL) {
+    // palette canvas has no delta path, clear what is left of last drawn canvas outside new canvas and draw it whole
+    if(screensaver_drawn_)
+      ClearRectOutside(screensaver_drawn_x1_, screensaver_drawn_y1_, screensaver_drawn_w_, screensaver_drawn_h_, frame_x1, screensaver_y1_, screensaver_w_, screensaver_h_);
+    FastDrawPaletteBitmapSpi(frame_x1, screensaver_y1_, palette_canvas_->getBuffer(), screensaver_w_, screensaver_h_, palette_canvas_->bits_per_pixel(), screensaver_palette_);
+  }
+  else if(screensaver_drawn_ && !canvas_rebuilt) {
+    // same canvas and color as last frame, send only changed pixels
+    ScreensaverDeltaDraw(screensaver_drawn_x1_, screensaver_drawn_y1_, frame_x1, screensaver_y1_, kColorPickerWheel[current_random_color_index_], kDisplayBackroundColor);
+  }
+  else {
+    // new canvas, clear what is left of last drawn canvas outside new canvas and draw it whole
+    if(screensaver_drawn_)
+      ClearRectOutside(screensaver_drawn_x1_, screensaver_drawn_y1_, screensaver_drawn_w_, screensaver_drawn_h_, frame_x1, screensaver_y1_, screensaver_w_, screensaver_h_);
+    FastDrawSpritesSpi(frame_x1, screensaver_y1_, screensaver_sprites_, kColorPickerWheel[current_random_color_index_], kDisplayBackroundColor);
+  }
+  if(SupportsHardwareScroll())
+    SetHardwareScroll(screensaver_x1_);
+  screensaver_drawn_ = true;
+  screensaver_drawn_x1_ = frame_x1;
+  screensaver_drawn_y1_ = screensaver_y1_;
+  screensaver_drawn_w_ = screensaver_w_;
+  screensaver_drawn_h_ = screensaver_h_;
   // // color LED Strip sequentially   ->   now done in loop1() by second core
 }
 
+/*!
+    @brief  Measure screensaver time and date rows and lay out canvas: HH:MM on top, date and bell
+            below it, both rows centered. Date is measured only when its text or font changes.
+*/
+void RGBDisplay::LayoutScreensaver() {
+  // get bounds of HH:MM text on screen
+  screensaver_time_atlas_.TextBounds(new_display_data_.time_HHMM, &gap_right_x_, &gap_up_y_, &tft_HHMM_w_, &tft_HHMM_h_);
+
+  // get bounds of date string, or of firmware updated string shown in its place
+  const GFXfont* date_font = (firmware_updated_flag_user_information ? &FreeMonoBold9pt7b : (rtc->hour() >= 10 ? &Satisfy_Regular24pt7b : &Satisfy_Regular18pt7b));
+  std::string date_text = (firmware_updated_flag_user_information ? "Firmware Updated " + kFirmwareVersion + "!" : std::string(new_display_data_.date_str));
+  if(date_font != screensaver_date_font_ || date_text != screensaver_date_text_) {
+    tft.setFont(date_font);
+    tft.getTextBounds(date_text.c_str(), 0, 0, &screensaver_date_gap_x_, &screensaver_date_gap_y_, &screensaver_date_w_, &screensaver_date_h_);
+    screensaver_date_font_ = date_font;
+    screensaver_date_text_ = date_text;
+    screensaver_date_sprite_drawn_ = false;
+  }
+
+  int16_t alarm_icon_w = (new_display_data_.alarm_ON ? kBellSmallWidth : kBellFallenSmallWidth);
+  int16_t alarm_icon_h = (new_display_data_.alarm_ON ? kBellSmallHeight : kBellFallenSmallHeight);
+  uint16_t date_row_w = screensaver_date_w_ + 2 * kScreensaverGapBand + alarm_icon_w;
+  screensaver_w_ = max(tft_HHMM_w_ + 5 * kScreensaverGapBand, date_row_w + 5 * kScreensaverGapBand);
+  screensaver_h_ = tft_HHMM_h_ + max((int)screensaver_date_h_, (int)alarm_icon_h) + 4 * kScreensaverGapBand;
+  // middle both rows
+  tft_HHMM_x0_ = (screensaver_w_ - tft_HHMM_w_) / 2 - gap_right_x_;
+  screensaver_date_x0_ = (screensaver_w_ - date_row_w) / 2 - screensaver_date_gap_x_ + kScreensaverGapBand;
+  screensaver_date_y0_ = screensaver_h_ - 5 * kScreensaverGapBand;
+
+  // canvas can not be bigger than screen
+  screensaver_w_ = min(screensaver_w_, kTftWidth);
+  screensaver_h_ = min(screensaver_h_, kTftHeight);
+}
+
+/*!
+    @brief  Draw screensaver on a palette canvas, time in a color ramp. Palette canvas takes the
+            whole canvas arena, so sprites have to be drawn again after it.
+    @return false if no palette canvas fits
+*/
+bool RGBDisplay::DrawScreensaverPaletteCanvas() {
+  palette_canvas_ = canvas_arena_.AcquirePalette(screensaver_w_, screensaver_h_, 4);
+  if(palette_canvas_ == NULL)
+    palette_canvas_ = canvas_arena_.AcquirePalette(screensaver_w_, screensaver_h_, 2);
+  if(palette_canvas_ == NULL)
+    return false;
+  screensaver_time_sprite_text_[0] = '\0';
+  screensaver_date_sprite_drawn_ = false;
+  palette_canvas_->setTextWrap(false);
+
+  // colors are palette indexes: time ramp, then date, then border
+  BuildScreensaverPalette(palette_canvas_->bits_per_pixel());
+  uint8_t border_index = (1 << palette_canvas_->bits_per_pixel()) - 1;
+  uint8_t date_index = border_index - 1;
+
+  // print HH:MM
+  screensaver_time_atlas_.PrintRamp(palette_canvas_, tft_HHMM_x0_ + kScreensaverGapBand, kScreensaverGapBand - gap_up_y_, new_display_data_.time_HHMM, 1, date_index);
+
+  // print date string and draw bell after it
+  palette_canvas_->setFont(screensaver_date_font_);
+  palette_canvas_->setTextColor(date_index);
+  palette_canvas_->setCursor(screensaver_date_x0_, screensaver_date_y0_);
+  palette_canvas_->print(screensaver_date_text_.c_str());
+  if(!firmware_updated_flag_user_information) {
+    int16_t alarm_icon_w = (new_display_data_.alarm_ON ? kBellSmallWidth : kBellFallenSmallWidth);
+    int16_t alarm_icon_h = (new_display_data_.alarm_ON ? kBellSmallHeight : kBellFallenSmallHeight);
+    const uint8_t* bell_bitmap = (new_display_data_.alarm_ON ? kBellSmallBitmap : kBellFallenSmallBitmap);
+    palette_canvas_->DrawAlignedBitmap(palette_canvas_->getCursorX() + 2 * kScreensaverGapBand, screensaver_h_ - alarm_icon_h - 3 * kScreensaverGapBand, bell_bitmap, alarm_icon_w, alarm_icon_h, date_index);
+  }
+
+  if(show_colored_edge_screensaver_)
+    palette_canvas_->drawRect(0, 0, screensaver_w_, screensaver_h_, border_index);  // canvas border
+  return true;
+}
+
+/*!
+    @brief  Place screensaver time, date and bell sprites for current layout. Time and date are
+            rendered into their own arena layers only when their text changed, the bell is sent
+            straight from its flash bitmap and the border is added while rows are composed.
+    @return false if a layer does not fit in arena
+*/
+bool RGBDisplay::ComposeScreensaverSprites() {
+  screensaver_sprites_.SetSize(screensaver_w_, screensaver_h_);
+  screensaver_sprites_.SetBorder(show_colored_edge_screensaver_);
+
+  // HH:MM, with incorrect time banner it is a full width layer with the banner over its top
+  bool incorrect_time = (rtc->year() < 2024);
+  if(incorrect_time || strcmp(screensaver_time_sprite_text_, new_display_data_.time_HHMM) != 0) {
+    ArenaCanvas1* layer = (incorrect_time ? canvas_arena_.AcquireLayer(kScreensaverTimeLayer, screensaver_w_, max((int16_t)(kScreensaverGapBand + tft_HHMM_h_), kTimeRowY0IncorrectTime))
+                                          : canvas_arena_.AcquireLayer(kScreensaverTimeLayer, tft_HHMM_w_, tft_HHMM_h_));
+    if(layer == NULL)
+      return false;
+    if(incorrect_time) {
+      screensaver_time_atlas_.Print(layer, tft_HHMM_x0_ + kScreensaverGapBand, kScreensaverGapBand - gap_up_y_, new_display_data_.time_HHMM);
+      my_canvas_ = layer;
+      IncorrectTimeBanner();
+      my_canvas_ = NULL;
+      screensaver_time_sprite_text_[0] = '\0';
+    }
+    else {
+      screensaver_time_atlas_.Print(layer, -gap_right_x_, -gap_up_y_, new_display_data_.time_HHMM);
+      strcpy(screensaver_time_sprite_text_, new_display_data_.time_HHMM);
+    }
+    screensaver_time_layer_ = layer;
+  }
+  if(incorrect_time)
+    screensaver_sprites_.SetSprite(kScreensaverTimeSprite, screensaver_time_layer_->getBuffer(), 0, 0, screensaver_time_layer_->width(), screensaver_time_layer_->height());
+  else
+    screensaver_sprites_.SetSprite(kScreensaverTimeSprite, screensaver_time_layer_->getBuffer(), tft_HHMM_x0_ + kScreensaverGapBand + gap_right_x_, kScreensaverGapBand, tft_HHMM_w_, tft_HHMM_h_);
+
+  // date string, or firmware updated string
+  if(!screensaver_date_sprite_drawn_) {
+    ArenaCanvas1* layer = canvas_arena_.AcquireLayer(kScreensaverDateLayer, screensaver_date_w_, screensaver_date_h_);
+    if(layer == NULL)
+      return false;
+    layer->setTextWrap(false);
+    layer->setFont(screensaver_date_font_);
+    layer->setCursor(-screensaver_date_gap_x_, -screensaver_date_gap_y_);
+    layer->print(screensaver_date_text_.c_str());
+    screensaver_date_advance_ = layer->getCursorX() + screensaver_date_gap_x_;
+    screensaver_date_layer_ = layer;
+    screensaver_date_sprite_drawn_ = true;
+  }
+  screensaver_sprites_.SetSprite(kScreensaverDateSprite, screensaver_date_layer_->getBuffer(), screensaver_date_x0_ + screensaver_date_gap_x_, screensaver_date_y0_ + screensaver_date_gap_y_, screensaver_date_w_, screensaver_date_h_);
+
+  // bell after date
+  if(!firmware_updated_flag_user_information) {
+    int16_t alarm_icon_w = (new_display_data_.alarm_ON ? kBellSmallWidth : kBellFallenSmallWidth);
+    int16_t alarm_icon_h = (new_display_data_.alarm_ON ? kBellSmallHeight : kBellFallenSmallHeight);
+    const uint8_t* bell_bitmap = (new_display_data_.alarm_ON ? kBellSmallBitmap : kBellFallenSmallBitmap);
+    screensaver_sprites_.SetSprite(kScreensaverBellSprite, bell_bitmap, screensaver_date_x0_ + screensaver_date_advance_ + 2 * kScreensaverGapBand, screensaver_h_ - alarm_icon_h - 3 * kScreensaverGapBand, alarm_icon_w, alarm_icon_h);
+  }
+  else
+    screensaver_sprites_.ClearSprite(kScreensaverBellSprite);
+  return true;
+}
+
+void RGBDisplay::DumpCanvasPbm() {
+  // screensaver sprites are composed here, other screens draw whole canvases
+  const ArenaCanvas1* canvas = canvas_arena_.LastCanvas();
+  bool sprites = (current_page == kScreensaverPage && palette_canvas_ == NULL);
+  int16_t w = (sprites ? screensaver_sprites_.width() : canvas->width()), h = (sprites ? screensaver_sprites_.height() : canvas->height());
+  // plain PBM, 1 = lit pixel
+  Serial.println(F("P1"));
+  Serial.print(w); Serial.print(kCharSpace); Serial.println(h);
+  char row[kTftWidth + 1];
+  for(int16_t y = 0; y < h; y++) {
+    for(int16_t x = 0; x < w; x++)
+      row[x] = ((sprites ? screensaver_sprites_.GetPixel(x, y) : canvas->getPixel(x, y)) ? '1' : '0');
+    row[w] = '\0';
+    Serial.println(row);
+  }
+  Serial.flush();
+}
+
 void RGBDisplay::PickNewRandomColor() {
   int newIndex = current_random_color_index_;
   while(newIndex == current_random_color_index_)
@@ -1201,6 +1652,42 @@ void RGBDisplay::PickNewRandomColor() {
   // PrintLn("current_random_color_index_ = ", current_random_color_index_);
 }
 
+// gradient screensaver palette: 0 background, 1 to last - 1 ramp from current random color to the
+// opposite color of the wheel (last - 1 is also the date color), last is the white border
+void RGBDisplay::BuildScreensaverPalette(uint8_t bits_per_pixel) {
+  uint8_t last = (1 << bits_per_pixel) - 1;
+  uint16_t top = kColorPickerWheel[current_random_color_index_];
+  uint16_t bottom = kColorPickerWheel[(current_random_color_index_ + kColorPickerWheelSize / 2) % kColorPickerWheelSize];
+  screensaver_palette_[0] = kDisplayBackroundColor;
+  for(uint8_t i = 1; i < last; i++) {
+    // mix RGB565 channels, weight of bottom color goes 0 to steps
+    uint8_t steps = max(last - 2, 1), weight = i - 1;
+    uint16_t r = (((top >> 11) & 0x1F) * (steps - weight) + ((bottom >> 11) & 0x1F) * weight) / steps;
+    uint16_t g = (((top >> 5) & 0x3F) * (steps - weight) + ((bottom >> 5) & 0x3F) * weight) / steps;
+    uint16_t b = ((top & 0x1F) * (steps - weight) + (bottom & 0x1F) * weight) / steps;
+    screensaver_palette_[i] = (r << 11) | (g << 5) | b;
+  }
+  screensaver_palette_[last] = kDisplayColorWhite;
+}
+
+// fill with background the part of rectangle (x, y, w, h) that lies outside rectangle (keep_x, keep_y, keep_w, keep_h)
+void RGBDisplay::ClearRectOutside(int16_t x, int16_t y, int16_t w, int16_t h, int16_t keep_x, int16_t keep_y, int16_t keep_w, int16_t keep_h) {
+  int16_t ix0 = max(x, keep_x), iy0 = max(y, keep_y);
+  int16_t ix1 = min(x + w, keep_x + keep_w), iy1 = min(y + h, keep_y + keep_h);
+  if(ix0 >= ix1 || iy0 >= iy1) {   // no overlap
+    tft.fillRect(x, y, w, h, kDisplayBackroundColor);
+    return;
+  }
+  if(iy0 > y)   // top strip
+    tft.fillRect(x, y, w, iy0 - y, kDisplayBackroundColor);
+  if(y + h > iy1)   // bottom strip
+    tft.fillRect(x, iy1, w, y + h - iy1, kDisplayBackroundColor);
+  if(ix0 > x)   // left strip
+    tft.fillRect(x, iy0, ix0 - x, iy1 - iy0, kDisplayBackroundColor);
+  if(x + w > ix1)   // right strip
+    tft.fillRect(ix1, iy0, x + w - ix1, iy1 - iy0, kDisplayBackroundColor);
+}
+
 void RGBDisplay::DisplayTimeUpdate() {
 
   bool isThisTheFirstTime = strcmp(displayed_data_.time_SS, "") == 0;
@@ -1215,40 +1702,30 @@ void RGBDisplay::DisplayTimeUpdate() {
 
   if(1) {   // CODE USES CANVAS AND ALWAYS PUTS HH:MM:SS AmPm on it every second
 
-    // delete canvas if it exists
+    // release canvas if it is held
     if(my_canvas_ != NULL) {
-      delete my_canvas_;
+      canvas_arena_.Release();
       my_canvas_ = NULL;
-      // myCanvas.reset(nullptr);
     }
 
-    // create new canvas for time row
+    // get canvas for time row from arena
     if(rtc->year() < 2024)  { // incorrect time
-      my_canvas_ = new GFXcanvas1(kTftWidth, kTimeRowY0IncorrectTime);
+      my_canvas_ = canvas_arena_.Acquire(kTftWidth, kTimeRowY0IncorrectTime);
 
       IncorrectTimeBanner();
 
       // draw canvas to tft   fastDrawBitmap
       FastDrawTwoColorBitmapSpi(0, 0, my_canvas_->getBuffer(), kTftWidth, kTimeRowY0IncorrectTime, kDisplayTimeColor, kDisplayBackroundColor); // Copy to screen
+
+      // banner covers time row, redraw it fully next time
+      displayed_time_row_cell_count_ = 0;
     }
     else {
-      my_canvas_ = new GFXcanvas1(kTftWidth, kTimeRowY0 + 6);
-      my_canvas_->fillScreen(kDisplayBackroundColor);
-      my_canvas_->setTextWrap(false);
-
+      my_canvas_ = canvas_arena_.Acquire(kTftWidth, kTimeRowY0 + 6);
       // HH:MM
 
-      // set font
-      my_canvas_->setFont(&FreeSansBold48pt7b);
-
-      // home the cursor
-      my_canvas_->setCursor(kTimeRowX0 + hh_gap_x, kTimeRowY0);
-
-      // change the text color to foreground color
-      my_canvas_->setTextColor(kDisplayTimeColor);
-
-      // draw the new time value
-      my_canvas_->print(new_display_data_.time_HHMM);
+      // draw the new time value, cursor ends at right of HH:MM
+      int16_t x0_pos = main_time_atlas_.Print(my_canvas_, kTimeRowX0 + hh_gap_x, kTimeRowY0, new_display_data_.time_HHMM);
       // tft.setTextSize(1);
       // delay(2000);
 
@@ -1258,24 +1735,9 @@ void RGBDisplay::DisplayTimeUpdate() {
 
       // AM/PM
 
-      int16_t x0_pos = my_canvas_->getCursorX();
-
-      // set font
-      my_canvas_->setFont(&FreeSans18pt7b);
-
       // draw new AM/PM
-      if(new_display_data_._12_hour_mode) {
-
-        // home the cursor
-        my_canvas_->setCursor(x0_pos + kDisplayTextGap, kAM_PM_row_Y0);
-        // Serial.print("tft_AmPm_x0 "); Serial.print(tft_AmPm_x0); Serial.print(" y0 "); Serial.print(tft_AmPm_y0); Serial.print(" tft.getCursorX() "); Serial.print(tft.getCursorX()); Serial.print(" tft.getCursorY() "); Serial.println(tft.getCursorY()); 
-
-        // draw the new time value
-        if(new_display_data_.pm_not_am)
-          my_canvas_->print(kPmLabel);
-        else
-          my_canvas_->print(kAmLabel);
-      }
+      if(new_display_data_._12_hour_mode)
+        main_time_small_atlas_.Print(my_canvas_, x0_pos + kDisplayTextGap, kAM_PM_row_Y0, (new_display_data_.pm_not_am ? kPmLabel : kAmLabel));
 
       // and remember the new value
       displayed_data_._12_hour_mode = new_display_data_._12_hour_mode;
@@ -1284,23 +1746,43 @@ void RGBDisplay::DisplayTimeUpdate() {
 
       // :SS
 
-      // home the cursor
-      my_canvas_->setCursor(x0_pos + kDisplayTextGap, kTimeRowY0);
-
       // draw the new time value
-      my_canvas_->print(new_display_data_.time_SS);
+      main_time_small_atlas_.Print(my_canvas_, x0_pos + kDisplayTextGap, kTimeRowY0, new_display_data_.time_SS);
 
       // and remember the new value
       strcpy(displayed_data_.time_SS, new_display_data_.time_SS);
 
-      // draw canvas to tft   fastDrawBitmap
-      FastDrawTwoColorBitmapSpi(0, 0, my_canvas_->getBuffer(), kTftWidth, kTimeRowY0 + 6, kDisplayTimeColor, kDisplayBackroundColor); // Copy to screen
+      // character cells of new time row
+      TimeRowCell new_cells[kTimeRowMaxCells];
+      uint8_t new_cell_count = LayoutTimeRowCells(hh_gap_x, new_cells);
+
+      if(isThisTheFirstTime || displayed_time_row_cell_count_ == 0) {
+        // draw canvas to tft   fastDrawBitmap
+        FastDrawTwoColorBitmapSpi(0, 0, my_canvas_->getBuffer(), kTftWidth, kTimeRowY0 + 6, kDisplayTimeColor, kDisplayBackroundColor); // Copy to screen
+      }
+      else {
+        // draw only cells whose character or place changed, old cell area is redrawn too to erase old character
+        for(uint8_t i = 0; i < max(new_cell_count, displayed_time_row_cell_count_); i++) {
+          TimeRowCell* old_cell = (i < displayed_time_row_cell_count_ ? &displayed_time_row_cells_[i] : NULL);
+          TimeRowCell* new_cell = (i < new_cell_count ? &new_cells[i] : NULL);
+          bool same_place = (old_cell != NULL && new_cell != NULL && old_cell->x == new_cell->x && old_cell->y == new_cell->y && old_cell->w == new_cell->w && old_cell->h == new_cell->h);
+          if(same_place && old_cell->c == new_cell->c)
+            continue;
+          if(old_cell != NULL)
+            FastDrawTwoColorBitmapRegionSpi(my_canvas_->getBuffer(), kTftWidth, kTimeRowY0 + 6, old_cell->x, old_cell->y, old_cell->w, old_cell->h, kDisplayTimeColor, kDisplayBackroundColor);
+          if(new_cell != NULL && !same_place)
+            FastDrawTwoColorBitmapRegionSpi(my_canvas_->getBuffer(), kTftWidth, kTimeRowY0 + 6, new_cell->x, new_cell->y, new_cell->w, new_cell->h, kDisplayTimeColor, kDisplayBackroundColor);
+        }
+      }
+
+      // and remember displayed cells
+      memcpy(displayed_time_row_cells_, new_cells, new_cell_count * sizeof(TimeRowCell));
+      displayed_time_row_cell_count_ = new_cell_count;
     }
 
-    // delete created canvas and null the pointer
-    delete my_canvas_;
+    // release canvas and null the pointer
+    canvas_arena_.Release();
     my_canvas_ = NULL;
-    // myCanvas.reset(nullptr);
 
   }
   else {    // CODE THAT CHECKS AND UPDATES ONLY CHANGES ON SCREEN HH:MM :SS AmPm
@@ -1462,7 +1944,7 @@ void RGBDisplay::DisplayTimeUpdate() {
       // if time is incorrect then don't bother drawing date row
 
       // draw settings gear
-      tft.drawBitmap(kSettingsGearX1, kSettingsGearY1, kSettingsGearBitmap, kSettingsGearWidth, kSettingsGearHeight, RGB565_Sandy_brown); // Copy to screen
+      FastDrawTwoColorBitmapSpi(kSettingsGearX1, kSettingsGearY1, kSettingsGearBitmap, kSettingsGearWidth, kSettingsGearHeight, RGB565_Sandy_brown, kDisplayBackroundColor);
     }
     else {
       // set font
@@ -1500,7 +1982,7 @@ void RGBDisplay::DisplayTimeUpdate() {
       tft.print(new_display_data_.date_str);
 
       // draw settings gear
-      tft.drawBitmap(kSettingsGearX1, kSettingsGearY1, kSettingsGearBitmap, kSettingsGearWidth, kSettingsGearHeight, RGB565_Sandy_brown); // Copy to screen
+      FastDrawTwoColorBitmapSpi(kSettingsGearX1, kSettingsGearY1, kSettingsGearBitmap, kSettingsGearWidth, kSettingsGearHeight, RGB565_Sandy_brown, kDisplayBackroundColor);
 
       // and remember the new value
       strcpy(displayed_data_.date_str, new_display_data_.date_str);
@@ -1535,7 +2017,7 @@ void RGBDisplay::DisplayTimeUpdate() {
       }
 
       // erase bell
-      tft.drawBitmap(alarm_icon_x0_, alarm_icon_y0_, (displayed_data_.alarm_ON ? kBellBitmap : kBellFallenBitmap), alarm_icon_w, alarm_icon_h, kDisplayBackroundColor);
+      tft.fillRect(alarm_icon_x0_, alarm_icon_y0_, alarm_icon_w, alarm_icon_h, kDisplayBackroundColor);
     }
 
     //  Redraw new alarm data
@@ -1578,8 +2060,9 @@ void RGBDisplay::DisplayTimeUpdate() {
     // draw the new alarmStr value
     tft.print(new_display_data_.alarm_str);
 
-    // draw bell
-    tft.drawBitmap(alarm_icon_x0_, alarm_icon_y0_, (new_display_data_.alarm_ON ? kBellBitmap : kBellFallenBitmap), alarm_icon_w, alarm_icon_h, kDisplayAlarmColor);
+    // draw bell, its whole rect is sent so background under it is drawn too
+    FastDrawTwoColorBitmapSpi(alarm_icon_x0_, alarm_icon_y0_, (new_display_data_.alarm_ON ? kBellBitmap : kBellFallenBitmap), alarm_icon_w, alarm_icon_h, kDisplayAlarmColor,
+      (firmware_updated_flag_user_information ? kDisplayColorGrey : kDisplayBackroundColor));
 
     // and remember the new value
     strcpy(displayed_data_.alarm_str, new_display_data_.alarm_str);
@@ -1606,6 +2089,33 @@ void RGBDisplay::DisplayTimeUpdate() {
   redraw_display_ = false;
 }
 
+// lay out character cells of main page time row: HH:MM, AM/PM and :SS, as drawn in DisplayTimeUpdate()
+uint8_t RGBDisplay::LayoutTimeRowCells(int16_t hh_gap_x, TimeRowCell* cells) {
+  uint8_t cell_count = 0;
+  int16_t x0_pos = 0, cursor_x = 0;
+  cell_count = LayoutTextCells(main_time_atlas_, new_display_data_.time_HHMM, kTimeRowX0 + hh_gap_x, kTimeRowY0, cells, cell_count, &x0_pos);
+  if(new_display_data_._12_hour_mode)
+    cell_count = LayoutTextCells(main_time_small_atlas_, (new_display_data_.pm_not_am ? kPmLabel : kAmLabel), x0_pos + kDisplayTextGap, kAM_PM_row_Y0, cells, cell_count, &cursor_x);
+  cell_count = LayoutTextCells(main_time_small_atlas_, new_display_data_.time_SS, x0_pos + kDisplayTextGap, kTimeRowY0, cells, cell_count, &cursor_x);
+  return cell_count;
+}
+
+// append one cell per character of text drawn with atlas at baseline (x, baseline_y), cells span the atlas line height
+uint8_t RGBDisplay::LayoutTextCells(const GlyphAtlas& atlas, const char* text, int16_t x, int16_t baseline_y, TimeRowCell* cells, uint8_t cell_count, int16_t* cursor_x) {
+  int16_t line_y1;
+  uint16_t line_h;
+  atlas.LineBounds(&line_y1, &line_h);
+  for(const char* c = text; *c != '\0' && cell_count < kTimeRowMaxCells; c++) {
+    int16_t span_x1;
+    uint16_t span_w;
+    uint8_t x_advance = atlas.CharSpan(*c, &span_x1, &span_w);
+    cells[cell_count++] = TimeRowCell{*c, (int16_t)(x + span_x1), (int16_t)(baseline_y + line_y1), span_w, line_h};
+    x += x_advance;
+  }
+  *cursor_x = x;
+  return cell_count;
+}
+
 void RGBDisplay::IncorrectTimeBanner() {
   // RTC Time is not Set!
   my_canvas_->fillRect(0, 0, kTftWidth, kTimeRowY0IncorrectTime, kDisplayBackroundColor);
@@ -1652,150 +2162,201 @@ void RGBDisplay::GoodMorningScreen() {
   // redraw the old value to erase
   tft.print(F("MORNING!!"));
 
-  int16_t x0 = 80, y0 = 80;
-  uint16_t edge = 160;
-  
-  unsigned int startTime = millis();
+  bool sun_prepared = PrepareSun(/* x0 = */ 80, /* y0 = */ 80, /* edge = */ 160);
+
+  unsigned long start_millis = millis();
 
   // start tone
   int tone_note_index = 0;
-  unsigned long next_tone_change_time = startTime;
+  unsigned long next_tone_change_time = start_millis;
   alarm_clock->celebrateSong(tone_note_index, next_tone_change_time);
 
-  while(millis() - startTime < 5000)
-    DrawSun(x0, y0, edge, tone_note_index, next_tone_change_time);
-
-  tft.fillScreen(kDisplayColorBlack);
-  redraw_display_ = true;
-}
+  // frames and melody run off one frame clock, the core sleeps in between
+  FrameGovernor sun_governor;
+  sun_governor.SetTargetFps(1000 / kSunFrameMs);
+  // button is usually still held from ending the alarm, so only a new press or touch ends the animation early
+  bool was_pressed = true;
+  while(millis() - start_millis < kGoodMorningScreenMs) {
+    ResetWatchdog();
+    if(sun_prepared && sun_governor.FrameDue())
+      DrawSunFrame(((millis() - start_millis) / kSunFrameMs) % kSunFrames);
 
-/* draw Sun
- * 
- * params: top left corner 'x0' and 'y0', square edge length of graphic 'edge'
- */ 
-void RGBDisplay::DrawSun(int16_t x0, int16_t y0, uint16_t edge, int &tone_note_index, unsigned long &next_tone_change_time) {
+    // celebration tone
+    if(millis() >= next_tone_change_time)
+      alarm_clock->celebrateSong(tone_note_index, next_tone_change_time);
 
-  // set dimensions of sun and rays
+    // loop() is held up here, keep time arrays current every second, the new minute flag stays
+    // set for loop() and is handled on the next second after the animation
+    if(rtc->rtc_hw_sec_update_) {
+      rtc->rtc_hw_sec_update_ = false;
+      PrepareTimeDayDateArrays();
+    }
 
-  // sun center
-  int16_t cx = x0 + edge / 2, cy = y0 + edge / 2;
-  // sun radius
-  int16_t sr = edge * 0.23;
-  // length of rays
-  int16_t rl = edge * 0.09;
-  // rays inner radius
-  int16_t rr = sr + edge * 0.08;
-  // width of rays
-  int16_t rw = 5;
-  // number of rays
-  uint8_t rn = 12;
+    bool pressed = (AnyButtonPressed() || (ts != NULL && ts->IsTouched()));
+    if(pressed && !was_pressed)
+      break;
+    was_pressed = pressed;
 
-  // color
-  uint16_t color = kDisplayColorYellow;
-  uint16_t background = kDisplayColorBlack;
+    // wake up for next frame or next note, whichever comes first
+    unsigned long now = millis();
+    sun_governor.SleepUntilNextFrame(next_tone_change_time > now ? min(next_tone_change_time - now, (unsigned long)kSunFrameMs) : 0);
+  }
 
-  int16_t variation_prev = 0;
+  tft.fillScreen(kDisplayColorBlack);
+  redraw_display_ = true;
+}
 
-  // sun
-  tft.fillCircle(cx, cy, sr, color);
+/*!
+    @brief  Set up good morning sun animation: fit a canvas around sun and its rays at their
+            longest, and render eyes and smile once into a holes part of it that is cut out of
+            the sun every frame. If the arena has room, the rays and sun of the distinct frames
+            are rendered once too, as the top half of each, the bottom half is the top half
+            turned by 180 degrees as rays are 4 fold symmetric. The canvas takes the whole
+            arena, so screensaver layers are redrawn next time they are used.
+    @param  x0, y0  top left corner of sun graphic on screen
+    @param  edge  square edge length of sun graphic
+    @return false if canvas does not fit in arena
+*/
+bool RGBDisplay::PrepareSun(int16_t x0, int16_t y0, uint16_t edge) {
+  // sun radius, inner radius and length of rays
+  sun_r_ = edge * 23 / 100;
+  sun_ray_r_ = sun_r_ + edge * 8 / 100;
+  sun_ray_l_ = edge * 9 / 100;
+
+  // rays at their longest with half their width, 1px for rounding
+  int16_t half = sun_ray_r_ + kSunMaxVariation + sun_ray_l_ + kSunRayHalfWidth + 1;
+  int16_t box = 2 * half + 1;
+  sun_x0_ = x0 + edge / 2 - half;
+  sun_y0_ = y0 + edge / 2 - half;
+
+  screensaver_time_sprite_text_[0] = '\0';
+  screensaver_date_sprite_drawn_ = false;
+  // frame, holes and cached top halves, or only frame and holes when cache does not fit
+  int16_t cached_rows = 2 * box + kSunCachedFrames * (half + 1);
+  sun_frames_cached_ = ((uint32_t)((box + 7) >> 3) * cached_rows <= canvas_arena_.LastCanvas()->capacity_bytes());
+  sun_canvas_ = canvas_arena_.Acquire(box, (sun_frames_cached_ ? cached_rows : 2 * box));
+  if(sun_canvas_ == NULL)
+    return false;
 
   // eyes
-  int16_t eye_offset_x = sr / 2, eye_offset_y = sr / 3, eye_r = max(sr / 8, 3);
-  tft.fillCircle(cx - eye_offset_x, cy - eye_offset_y, eye_r, background);
-  tft.fillCircle(cx + eye_offset_x, cy - eye_offset_y, eye_r, background);
+  sun_canvas_->SetView(0, box, box, box);
+  int16_t eye_offset_x = sun_r_ / 2, eye_offset_y = sun_r_ / 3, eye_r = max(sun_r_ / 8, 3);
+  sun_canvas_->fillCircle(half - eye_offset_x, half - eye_offset_y, eye_r, 1);
+  sun_canvas_->fillCircle(half + eye_offset_x, half - eye_offset_y, eye_r, 1);
 
-  // draw smile
+  // smile
   int16_t smile_angle_deg = 37;
-  int16_t smile_cy = cy - sr / 2;
-  int16_t smile_r = sr * 1.1, smile_w = max(sr / 15, 3);
-  for(uint8_t i = 0; i <= smile_angle_deg; i=i+2) {
-    float smile_angle_rad = DEG_TO_RAD * i;
+  int16_t smile_cy = half - sun_r_ / 2;
+  int16_t smile_r = sun_r_ * 11 / 10, smile_w = max(sun_r_ / 15, 3);
+  for(int16_t i = 0; i <= smile_angle_deg; i = i + 2) {
+    uint16_t angle = DegreesToAngle(i);
     int16_t smile_tapered_w = max(smile_w - i / 13, 1);
-    // Serial.print(i); Serial.print(" "); Serial.print(smile_w); Serial.print(" "); Serial.println(smile_tapered_w);
-    int16_t smile_offset_x = smile_r * sin(smile_angle_rad), smile_offset_y = smile_r * cos(smile_angle_rad);
-    tft.fillCircle(cx - smile_offset_x, smile_cy + smile_offset_y, smile_tapered_w, background);
-    tft.fillCircle(cx + smile_offset_x, smile_cy + smile_offset_y, smile_tapered_w, background);
+    int16_t smile_offset_x = MulQ15(smile_r, SineQ15(angle)), smile_offset_y = MulQ15(smile_r, CosineQ15(angle));
+    sun_canvas_->fillCircle(half - smile_offset_x, smile_cy + smile_offset_y, smile_tapered_w, 1);
+    sun_canvas_->fillCircle(half + smile_offset_x, smile_cy + smile_offset_y, smile_tapered_w, 1);
   }
 
-  // draw changing rays
-  for(int16_t i = 0; i < 120; i++) {
-    ResetWatchdog();
-    // variation goes from 0 to 5 to 0
-    int16_t i_base10_fwd = i % 10;
-    int16_t i_base10_bwd = ((i / 10) + 1) * 10 - i;
-    int16_t variation = min(i_base10_fwd, i_base10_bwd);
-    // Serial.println(variation);
-    int16_t r_variable = rr + variation;
-    // draw rays
-    DrawRays(cx, cy, r_variable, rl, rw, rn, i, color);
-    // increase sun size
-    // tft.drawCircle(cx, cy, sr + variation, color);
-    DrawDenseCircle(cx, cy, sr + variation, color);
-    // show for sometime
-    delay(30);
-
-    // undraw rays
-    DrawRays(cx, cy, r_variable, rl, rw, rn, i, background);
-    // reduce sun size
-    if(variation < variation_prev){
-      // tft.drawCircle(cx, cy, sr + variation_prev, background);
-      DrawDenseCircle(cx, cy, sr + variation_prev + 1, background);
+  // rays and sun of frames 0 to kSunCachedFrames - 1, view keeps the top half of each
+  if(sun_frames_cached_) {
+    for(uint8_t frame = 0; frame < kSunCachedFrames; frame++) {
+      sun_canvas_->SetView(0, 2 * box + frame * (half + 1), box, half + 1);
+      DrawSunRaysAndDisk(sun_canvas_, frame);
     }
-    // delay(1000);
-    variation_prev = variation;
+  }
+  sun_canvas_->ResetView();
+  return true;
+}
 
-    // celebration tone
-    if(millis() > next_tone_change_time)
-      alarm_clock->celebrateSong(tone_note_index, next_tone_change_time);
+/*!
+    @brief  Draw rays and sun of a frame into canvas view: rays turned by frame degrees, sun
+            and rays pulsing in and out by up to kSunMaxVariation px every 10 frames.
+    @param  canvas  canvas with view at top left of a box x box sun frame
+    @param  frame  0 to kSunFrames - 1
+*/
+void RGBDisplay::DrawSunRaysAndDisk(ArenaCanvas1* canvas, uint8_t frame) {
+  int16_t half = canvas->width() / 2;
+
+  // variation goes from 0 to 5 to 0
+  int16_t variation = min(frame % 10, ((frame / 10) + 1) * 10 - frame);
+  int16_t rr = sun_ray_r_ + variation, rl = rr + sun_ray_l_;
+
+  // rays, each is two triangles
+  for(uint8_t i = 0; i < kSunRays; i++) {
+    uint16_t theta = DegreesToAngle(i * (360 / kSunRays) + frame);
+    int16_t sin_q15 = SineQ15(theta), cos_q15 = CosineQ15(theta);
+    int16_t rcos = MulQ15(rr, cos_q15), rsin = MulQ15(rr, sin_q15);
+    int16_t rlcos = MulQ15(rl, cos_q15), rlsin = MulQ15(rl, sin_q15);
+    int16_t w2sin = MulQ15(kSunRayHalfWidth, sin_q15), w2cos = MulQ15(kSunRayHalfWidth, cos_q15);
+    int16_t x1 = half + rcos - w2sin, y1 = half + rsin + w2cos;
+    int16_t x2 = half + rcos + w2sin, y2 = half + rsin - w2cos;
+    int16_t x3 = half + rlcos + w2sin, y3 = half + rlsin - w2cos;
+    int16_t x4 = half + rlcos - w2sin, y4 = half + rlsin + w2cos;
+    canvas->fillTriangle(x1, y1, x2, y2, x3, y3, 1);
+    canvas->fillTriangle(x1, y1, x3, y3, x4, y4, 1);
   }
+
+  // sun
+  canvas->fillCircle(half, half, sun_r_ + variation, 1);
 }
 
-/* draw rays
- * 
- * params: center cx, cy; inner radius of rays rr, length of rays rl, width of rays rw, number of rays rn, start angle degStart, color
- */ 
-void RGBDisplay::DrawRays(int16_t &cx, int16_t &cy, int16_t &rr, int16_t &rl, int16_t &rw, uint8_t &rn, int16_t &degStart, uint16_t &color) {
-  // rays
-  for(uint8_t i = 0; i < rn; i++) {
-    // find coordinates of two triangles for each ray and use fillTriangle function to draw rays
-    float theta = 2 * PI * i / rn + degStart * DEG_TO_RAD;
-    double rcos = rr * cos(theta), rlcos = (rr + rl) * cos(theta), rsin = rr * sin(theta), rlsin = (rr + rl) * sin(theta);
-    double w2sin = rw / 2 * sin(theta), w2cos = rw / 2 * cos(theta);
-    int16_t x1 = cx + rcos - w2sin;
-    int16_t x2 = cx + rcos + w2sin;
-    int16_t x3 = cx + rlcos + w2sin;
-    int16_t x4 = cx + rlcos - w2sin;
-    int16_t y1 = cy + rsin + w2cos;
-    int16_t y2 = cy + rsin - w2cos;
-    int16_t y3 = cy + rlsin - w2cos;
-    int16_t y4 = cy + rlsin + w2cos;
-    tft.fillTriangle(x1, y1, x2, y2, x3, y3, color);
-    tft.fillTriangle(x1, y1, x3, y3, x4, y4, color);
-  }
-}
-
-/* drawDenseCircle
- * densely pack a circle's circumference
- */
-void RGBDisplay::DrawDenseCircle(int16_t &cx, int16_t &cy, int16_t r, uint16_t &color) {
-  // calculate angular resolution required
-  // r*dTheta = 0.5
-  double dTheta = 0.5 / static_cast<double>(r);
-  // number of runs to cover quarter circle
-  uint32_t n = PI / 2 / dTheta;
-  // Serial.print("dTheta "); Serial.print(dTheta, 5); Serial.print(" n "); Serial.println(n);
-
-  for(uint32_t i = 0; i < n; i++) {
-    float theta = i * dTheta; // Serial.print(" theta "); Serial.println(theta);
-    int16_t rcos = r * cos(theta);
-    int16_t rsin = r * sin(theta);
-    tft.drawPixel(cx + rcos, cy + rsin, color);
-    tft.drawPixel(cx - rcos, cy + rsin, color);
-    tft.drawPixel(cx + rcos, cy - rsin, color);
-    tft.drawPixel(cx - rcos, cy - rsin, color);
+static uint8_t ReverseBits(uint8_t b) {
+  b = (b & 0xF0) >> 4 | (b & 0x0F) << 4;
+  b = (b & 0xCC) >> 2 | (b & 0x33) << 2;
+  return (b & 0xAA) >> 1 | (b & 0x55) << 1;
+}
+
+// reverse w pixels of a 1-bit row: bytes reversed in reverse order put the padding past w in
+// front, so they are shifted left by it and padding stays clear
+static void ReverseRowBits(const uint8_t* src, uint8_t* dst, int16_t w) {
+  int16_t row_bytes = (w + 7) >> 3;
+  uint8_t pad = row_bytes * 8 - w;
+  uint8_t current = ReverseBits(src[row_bytes - 1]);
+  for(int16_t i = 0; i < row_bytes; i++) {
+    uint8_t next = (i + 1 < row_bytes ? ReverseBits(src[row_bytes - 2 - i]) : 0);
+    dst[i] = (current << pad) | (next >> (8 - pad));
+    current = next;
   }
 }
 
+/*!
+    @brief  Draw one frame of good morning sun, eyes and smile cut out, and blit the canvas once.
+            With cached frames the frame is put together from a cached top half, mirrored top
+            to bottom for frames past half a ray spacing, otherwise its rays and sun are rasterized.
+    @param  frame  0 to kSunFrames - 1
+*/
+void RGBDisplay::DrawSunFrame(uint8_t frame) {
+  int16_t box = sun_canvas_->width(), half = box / 2;
+  int16_t row_bytes = (box + 7) >> 3;
+  uint8_t* frame_bits = sun_canvas_->getBuffer();
+  const uint8_t* holes_bits = frame_bits + row_bytes * box;
+
+  if(sun_frames_cached_) {
+    uint8_t repeat_frame = frame % kSunRepeatFrames;
+    bool mirrored = (repeat_frame >= kSunCachedFrames);
+    const uint8_t* top_half = holes_bits + row_bytes * box + row_bytes * (half + 1) * (mirrored ? kSunRepeatFrames - repeat_frame : repeat_frame);
+    for(int16_t y = 0; y < box; y++) {
+      const uint8_t* cached_row = &top_half[row_bytes * min(y, (int16_t)(box - 1 - y))];
+      if(mirrored ? (y < half) : (y > half))
+        ReverseRowBits(cached_row, &frame_bits[row_bytes * y], box);
+      else
+        memcpy(&frame_bits[row_bytes * y], cached_row, row_bytes);
+    }
+  }
+  else {
+    sun_canvas_->SetView(0, 0, box, box);
+    sun_canvas_->fillScreen(0);
+    DrawSunRaysAndDisk(sun_canvas_, frame);
+    sun_canvas_->ResetView();
+  }
+
+  // eyes and smile, frame and holes have same size so whole bytes are masked
+  uint32_t bytes = (uint32_t)row_bytes * box;
+  for(uint32_t i = 0; i < bytes; i++)
+    frame_bits[i] &= ~holes_bits[i];
+
+  FastDrawTwoColorBitmapSpi(sun_x0_, sun_y0_, frame_bits, box, box, kDisplayColorYellow, kDisplayColorBlack);
+}
+
 // make keyboard on screen
 // credits: Andrew Mascolo https://github.com/AndrewMascolo/Adafruit_Stuff/blob/master/Sketches/Keyboard.ino
 void RGBDisplay::MakeKeyboard(const char type[][13], std::string label) {
@@ -1810,71 +2371,138 @@ void RGBDisplay::MakeKeyboard(const char type[][13], std::string label) {
   tft.setFont(NULL);
   tft.setTextSize(2);
 
-  // keys
-  tft.setTextColor(kTextRegularColor, kKeyboardButtonFillColor);
-  for (int y = 0; y < (kb_numbers_only ? 1 : 3); y++)
-  {
-    int ShiftRight = 10 * pgm_read_byte(&(type[y][0]));
-    for (int x = 3; x < 13; x++)
-    {
-      if (x >= pgm_read_byte(&(type[y][1]))) break;
-
-      DrawKeyboardButton(8 + (23 * (x - 3)) + ShiftRight, kTextAreaHeight + (30 * y), 20,25); // this will draw the button on the screen by so many pixels
-      tft.setCursor(12 + (23 * (x - 3)) + ShiftRight, kTextAreaHeight+5 + (30 * y));
-      tft.print(char(pgm_read_byte(&(type[y][x]))));
+  // character keys
+  KeyboardSprites& keys = keyboard_sprites_[keyboard_shown_];
+  keys.Build(type, KeyboardRows(), kTextAreaHeight);
+  for(uint8_t i = 0; i < keys.key_count(); i++) {
+    DrawKeyboardButton(keys.key(i).x, keys.key(i).y, KeyboardSprites::kKeyW, KeyboardSprites::kKeyH);
+    DrawKeyboardKeyFace(i, /* pressed = */ false);
+  }
+
+  // shift, numpad, space bar, delete, enter and back
+  for(uint8_t key = 0; key < kKeyboardSpecialKeyCount; key++)
+    if(KeyboardSpecialKeyShown(key))
+      DrawKeyboardSpecialKey(key, /* pressed = */ false);
+}
+
+/*!
+    @brief  Show keyboard layout for current shift and numpad state. Character keys are diffed
+            with shown layout: keys that have no key at their place are cleared, keys at a new
+            place are drawn whole and keys at same place only get their face blitted if their
+            label changed. Shift and numpad keys are restored when touch is released.
+*/
+void RGBDisplay::SwitchKeyboardLayout() {
+  const KeyboardSprites& old_keys = keyboard_sprites_[keyboard_shown_];
+  keyboard_shown_ ^= 1;
+  KeyboardSprites& new_keys = keyboard_sprites_[keyboard_shown_];
+  new_keys.Build(KeyboardLayout(), KeyboardRows(), kTextAreaHeight);
+
+  // clear old keys with their button shading
+  for(uint8_t i = 0; i < old_keys.key_count(); i++)
+    if(new_keys.KeyAtSamePlace(old_keys.key(i)) < 0)
+      tft.fillRect(old_keys.key(i).x - kKeyboardButtonShadingPx, old_keys.key(i).y, KeyboardSprites::kKeyW + kKeyboardButtonShadingPx, KeyboardSprites::kKeyH + kKeyboardButtonShadingPx, kDisplayBackroundColor);
+
+  for(uint8_t i = 0; i < new_keys.key_count(); i++) {
+    int8_t old_index = old_keys.KeyAtSamePlace(new_keys.key(i));
+    if(old_index < 0) {
+      DrawKeyboardButton(new_keys.key(i).x, new_keys.key(i).y, KeyboardSprites::kKeyW, KeyboardSprites::kKeyH);
+      DrawKeyboardKeyFace(i, /* pressed = */ false);
     }
+    else if(old_keys.key(old_index).label != new_keys.key(i).label)
+      DrawKeyboardKeyFace(i, /* pressed = */ false);
   }
+}
 
-  if(!kb_numbers_only && !kb_capitals_only) {
-    // ShiftKey
-    DrawKeyboardButton(220, kTextAreaHeight + 60, 90, 25);
-    if(GetKeyboardPress_shift)
-      tft.setTextColor(kTextHighLightColor, kKeyboardButtonFillColor);
-    else
-      tft.setTextColor(kTextRegularColor, kKeyboardButtonFillColor);
-    tft.setCursor(224, kTextAreaHeight + 65);
-    if(GetKeyboardPress_numpad)
-      tft.print("SPECIAL");
-    else
-      tft.print("CAPITAL");
+// layout table for current shift and numpad state
+const char (*RGBDisplay::KeyboardLayout())[13] {
+  if(GetKeyboardPress_numpad)
+    return (GetKeyboardPress_shift ? Mobile_SymKeys : Mobile_NumKeys);
+  return (GetKeyboardPress_shift ? Mobile_KB_Capitals : Mobile_KB_Smalls);
+}
 
-    // Numpad
-    DrawKeyboardButton(193, kTextAreaHeight + 90, 85, 25);
-    tft.setCursor(197, kTextAreaHeight + 95);
-    if(GetKeyboardPress_numpad)
-      tft.setTextColor(kTextHighLightColor, kKeyboardButtonFillColor);
-    else
-      tft.setTextColor(kTextRegularColor, kKeyboardButtonFillColor);
-    tft.print(F("NUMPAD"));
+uint8_t RGBDisplay::KeyboardRows() {
+  return (kb_numbers_only ? 1 : 3);
+}
 
-    // Spacebar
-    DrawKeyboardButton(40, kTextAreaHeight + 90, 140, 25);
-    tft.setCursor(58, kTextAreaHeight + 95);
-    tft.print(F("SPACE BAR"));
-  }
+// character key face with its label, a single blit; pressed keys have highlight background
+void RGBDisplay::DrawKeyboardKeyFace(uint8_t index, bool pressed) {
+  const KeyboardSprites& keys = keyboard_sprites_[keyboard_shown_];
+  FastDrawTwoColorBitmapSpi(keys.key(index).x + KeyboardSprites::kFaceOffset, keys.key(index).y + KeyboardSprites::kFaceOffset, keys.face(index),
+    KeyboardSprites::kFaceW, KeyboardSprites::kFaceH, kTextRegularColor, (pressed ? kTextHighLightColor : kKeyboardButtonFillColor));
+}
 
-  // Delete / Backspace
-  DrawKeyboardButton(250, kTextAreaHeight + 0, 50, 25);
-  tft.setCursor(254, kTextAreaHeight + 5);
-  tft.setTextColor(kTextRegularColor, kKeyboardButtonFillColor);
-  tft.print(F("DEL"));
+// shift, numpad and space bar are only on full keyboard
+bool RGBDisplay::KeyboardSpecialKeyShown(uint8_t key) {
+  if(key == kKeyboardShift || key == kKeyboardNumpad || key == kKeyboardSpace)
+    return (!kb_numbers_only && !kb_capitals_only);
+  return true;
+}
 
-  // Enter
-  DrawKeyboardButton(240, kTextAreaHeight + 30, 70, 25);
-  tft.setCursor(244, kTextAreaHeight + 35);
-  tft.print(F("ENTER"));
+void RGBDisplay::KeyboardSpecialKeyRect(uint8_t key, int16_t* x, int16_t* y, int16_t* w, int16_t* h) {
+  switch(key) {
+    case kKeyboardShift:  *x = 220; *y = kTextAreaHeight + 60; *w = 90; *h = 25; break;
+    case kKeyboardNumpad: *x = 193; *y = kTextAreaHeight + 90; *w = 85; *h = 25; break;
+    case kKeyboardSpace:  *x = 40;  *y = kTextAreaHeight + 90; *w = 140; *h = 25; break;
+    case kKeyboardDelete: *x = 250; *y = kTextAreaHeight + 0;  *w = 50; *h = 25; break;
+    case kKeyboardEnter:  *x = 240; *y = kTextAreaHeight + 30; *w = 70; *h = 25; break;
+    default:              *x = kBackButtonX1; *y = kBackButtonY1; *w = kBackButtonW; *h = kBackButtonH;
+  }
+}
 
-  // Back button
-  DrawKeyboardButton(kBackButtonX1, kBackButtonY1, kBackButtonW, kBackButtonH);
-  tft.setCursor(kBackButtonX1 + 5, kBackButtonY1 + 3);
-  tft.print(kBackStr);
+// special key shown on keyboard whose button contains (x, y), -1 if none
+int8_t RGBDisplay::KeyboardSpecialKeyAt(int16_t x, int16_t y) {
+  for(uint8_t key = 0; key < kKeyboardSpecialKeyCount; key++) {
+    int16_t key_x, key_y, key_w, key_h;
+    KeyboardSpecialKeyRect(key, &key_x, &key_y, &key_w, &key_h);
+    if(KeyboardSpecialKeyShown(key) && x >= key_x && x <= key_x + key_w && y >= key_y && y <= key_y + key_h)
+      return key;
+  }
+  return -1;
+}
+
+// special key button with its label, pressed keys are highlighted without label
+void RGBDisplay::DrawKeyboardSpecialKey(uint8_t key, bool pressed) {
+  int16_t x, y, w, h;
+  KeyboardSpecialKeyRect(key, &x, &y, &w, &h);
+  if(pressed) {
+    DrawKeyboardButton(x, y, w, h, kTextHighLightColor);
+    return;
+  }
+  DrawKeyboardButton(x, y, w, h);
+  tft.setTextColor(kTextRegularColor, kKeyboardButtonFillColor);
+  tft.setCursor(x + 4, y + 5);
+  switch(key) {
+    case kKeyboardShift:
+      if(GetKeyboardPress_shift)
+        tft.setTextColor(kTextHighLightColor, kKeyboardButtonFillColor);
+      tft.print(GetKeyboardPress_numpad ? F("SPECIAL") : F("CAPITAL"));
+      break;
+    case kKeyboardNumpad:
+      if(GetKeyboardPress_numpad)
+        tft.setTextColor(kTextHighLightColor, kKeyboardButtonFillColor);
+      tft.print(F("NUMPAD"));
+      break;
+    case kKeyboardSpace:
+      tft.setCursor(x + 18, y + 5);
+      tft.print(F("SPACE BAR"));
+      break;
+    case kKeyboardDelete:
+      tft.print(F("DEL"));
+      break;
+    case kKeyboardEnter:
+      tft.print(F("ENTER"));
+      break;
+    default:
+      tft.setCursor(x + 5, y + 3);
+      tft.print(kBackStr);
+  }
 }
 
 // helper function for MakeKeyboard
 // credits: Andrew Mascolo https://github.com/AndrewMascolo/Adafruit_Stuff/blob/master/Sketches/Keyboard.ino
 void RGBDisplay::DrawKeyboardButton(int x, int y, int w, int h, uint16_t kb_btn_fill_col) {
   // grey
-  tft.fillRoundRect(x - 3, y + 3, w, h, 3, 0x8888); //Button Shading
+  tft.fillRoundRect(x - kKeyboardButtonShadingPx, y + kKeyboardButtonShadingPx, w, h, 3, 0x8888); //Button Shading
 
   // white
   tft.fillRoundRect(x, y, w, h, 3, 0xffff);// outter button color
@@ -1886,227 +2514,91 @@ void RGBDisplay::DrawKeyboardButton(int x, int y, int w, int h) {
   DrawKeyboardButton(x, y, w, h, kKeyboardButtonFillColor);
 }
 
-bool RGBDisplay::IsTouchWithin(int x, int y, int w, int h) {
-  // tft.fillCircle(X, Y, 2, 0x0FF0);
-  bool touched = ((((ts->GetTouchedPixel())->x>=x)&&((ts->GetTouchedPixel())->x<=x + w)) & (((ts->GetTouchedPixel())->y>=y)&&((ts->GetTouchedPixel())->y<=y + h)));
-  if(touched) {
-    DrawKeyboardButton(x, y, w, h, kTextHighLightColor);
-    delay(100);
-  }
-  return touched;
+// typed text above keyboard, clear first when text got shorter
+void RGBDisplay::DrawKeyboardText(const char* text, bool clear) {
+  if(clear)
+    tft.fillRect(15, kTextAreaHeight - 30, tft.width() - 40, 20, kDisplayBackroundColor);
+  tft.setTextColor(kTextRegularColor, kKeyboardButtonFillColor);
+  tft.setCursor(15, kTextAreaHeight - 30);
+  tft.print(text);
 }
 
-// get keyboard presses on keyboard made by MakeKeyboard
-// credits: Andrew Mascolo https://github.com/AndrewMascolo/Adafruit_Stuff/blob/master/Sketches/Keyboard.ino
+/*!
+    @brief  Handle a touch on keyboard made by MakeKeyboard. A key is taken on touch down and
+            shown pressed until release, one key per touch. Only the pressed key, a layout
+            change or the typed text are redrawn.
+    @return false if back button is pressed
+*/
 bool RGBDisplay::GetKeyboardPress(char * textBuffer, std::string label, char * textReturn) {
-  //// static vars for Keyboard
-  //static bool GetKeyboardPress_shift = true, GetKeyboardPress_lastShift = true, GetKeyboardPress_numpad = false, GetKeyboardPress_lastNumpad = false;
-  static char bufIndex = 0;
-  // increase bufIndex to length of pre-filled user input
-  while(textBuffer[bufIndex] != '\0')
-    bufIndex++;
-
-  if (ts->IsTouched())
-  {
-    // check if back button is pressed
-    if (IsTouchWithin(kBackButtonX1, kBackButtonY1, kBackButtonW, kBackButtonH))
-    {
-      return false;
-    }
-
-    // ShiftKey
-    if (!kb_numbers_only && !kb_capitals_only && IsTouchWithin(220, kTextAreaHeight + 60, 90, 25))
-    {
-      delay(100);
-      DrawKeyboardButton(220, kTextAreaHeight + 60, 90, 25);
-      if(GetKeyboardPress_shift)
-        tft.setTextColor(kTextHighLightColor, kKeyboardButtonFillColor);
-      else
-        tft.setTextColor(kTextRegularColor, kKeyboardButtonFillColor);
-      tft.setCursor(224, kTextAreaHeight + 65);
-      if(GetKeyboardPress_numpad)
-        tft.print("SPECIAL");
-      else
-        tft.print("CAPITAL");
+  uint8_t bufIndex = strlen(textBuffer);
+
+  if(!ts->IsTouched()) {
+    // released, restore pressed key
+    if(keyboard_pressed_key_ >= 0)
+      DrawKeyboardKeyFace(keyboard_pressed_key_, /* pressed = */ false);
+    if(keyboard_pressed_special_key_ >= 0)
+      DrawKeyboardSpecialKey(keyboard_pressed_special_key_, /* pressed = */ false);
+    keyboard_pressed_key_ = -1;
+    keyboard_pressed_special_key_ = -1;
+    keyboard_touch_down_ = false;
+    return true;
+  }
+  if(keyboard_touch_down_)
+    return true;
+  keyboard_touch_down_ = true;
+  int16_t ts_x = ts->GetTouchedPixel()->x, ts_y = ts->GetTouchedPixel()->y;
 
-      GetKeyboardPress_shift = !GetKeyboardPress_shift;
+  // character keys
+  int8_t key = keyboard_sprites_[keyboard_shown_].KeyAt(ts_x, ts_y);
+  if(key >= 0) {
+    DrawKeyboardKeyFace(key, /* pressed = */ true);
+    keyboard_pressed_key_ = key;
+    if(bufIndex < kWifiSsidPasswordLengthMax) {
+      textBuffer[bufIndex++] = keyboard_sprites_[keyboard_shown_].key(key).label;
+      textBuffer[bufIndex] = '\0';
+      DrawKeyboardText(textBuffer, /* clear = */ false);
     }
+    return true;
+  }
 
-    // Numpad
-    if (!kb_numbers_only && !kb_capitals_only && IsTouchWithin(193, kTextAreaHeight + 90, 85, 25))
-    {
-      delay(100);
-      DrawKeyboardButton(193, kTextAreaHeight + 90, 85, 25);
-      tft.setCursor(197, kTextAreaHeight + 95);
-      if(GetKeyboardPress_numpad)
-        tft.setTextColor(kTextHighLightColor, kKeyboardButtonFillColor);
-      else
-        tft.setTextColor(kTextRegularColor, kKeyboardButtonFillColor);
-      tft.print(F("NUMPAD"));
+  int8_t special_key = KeyboardSpecialKeyAt(ts_x, ts_y);
+  if(special_key < 0)
+    return true;
+  if(special_key == kKeyboardBack)
+    return false;
+  DrawKeyboardSpecialKey(special_key, /* pressed = */ true);
+  keyboard_pressed_special_key_ = special_key;
 
+  switch(special_key) {
+    case kKeyboardShift:
+      GetKeyboardPress_shift = !GetKeyboardPress_shift;
+      SwitchKeyboardLayout();
+      break;
+    case kKeyboardNumpad:
       GetKeyboardPress_numpad = !GetKeyboardPress_numpad;
-    }
-
-    // re-draw keyboard if...
-    if (GetKeyboardPress_numpad != GetKeyboardPress_lastNumpad || GetKeyboardPress_shift != GetKeyboardPress_lastShift)
-    {
-      if (GetKeyboardPress_numpad)
-      {
-        if (GetKeyboardPress_shift)
-        {
-          tft.fillScreen(kDisplayBackroundColor);
-          MakeKeyboard(Mobile_SymKeys, label);
-        }
-        else
-        {
-          tft.fillScreen(kDisplayBackroundColor);
-          MakeKeyboard(Mobile_NumKeys, label);
-        }
-      }
-      else
-      {
-        if (GetKeyboardPress_shift)
-        {
-          tft.fillScreen(kDisplayBackroundColor);
-          MakeKeyboard(Mobile_KB_Capitals, label);
-          tft.setTextColor(kTextRegularColor, kKeyboardButtonFillColor);
-        }
-        else
-        {
-          tft.fillScreen(kDisplayBackroundColor);
-          MakeKeyboard(Mobile_KB_Smalls, label);
-          tft.setTextColor(kTextRegularColor, kKeyboardButtonFillColor);
-        }
-      }
-
-      if (GetKeyboardPress_numpad)
-        tft.setTextColor(kTextHighLightColor, kKeyboardButtonFillColor);
-      else
-        tft.setTextColor(kTextRegularColor, kKeyboardButtonFillColor);
-
-      tft.setCursor(197, kTextAreaHeight + 95);
-      tft.print(F("NUMPAD"));
-
-      if (GetKeyboardPress_shift)
-        tft.setTextColor(kTextHighLightColor, kKeyboardButtonFillColor);
-      else
-        tft.setTextColor(kTextRegularColor, kKeyboardButtonFillColor);
-
-      tft.setCursor(224, kTextAreaHeight + 65);
-      if (GetKeyboardPress_numpad)
-        tft.print("SPECIAL");
-      else
-        tft.print("CAPITAL");
-
-      GetKeyboardPress_lastNumpad = GetKeyboardPress_numpad;
-      GetKeyboardPress_lastShift = GetKeyboardPress_shift;
-    }
-
-    for (int y = 0; y < (kb_numbers_only ? 1 : 3); y++)
-    {
-      int ShiftRight;
-      if (GetKeyboardPress_numpad)
-      {
-        if (GetKeyboardPress_shift)
-          ShiftRight = 10 * pgm_read_byte(&(Mobile_SymKeys[y][0]));
-        else
-          ShiftRight = 10 * pgm_read_byte(&(Mobile_NumKeys[y][0]));
-      }
-      else
-      {
-        if (GetKeyboardPress_shift)
-          ShiftRight = 10 * pgm_read_byte(&(Mobile_KB_Capitals[y][0]));
-        else
-          ShiftRight = 10 * pgm_read_byte(&(Mobile_KB_Smalls[y][0]));
-      }
-
-      for (int x = 3; x < 13; x++)
-      {
-        if (x >=  (GetKeyboardPress_numpad ? (GetKeyboardPress_shift ? pgm_read_byte(&(Mobile_SymKeys[y][1])) : pgm_read_byte(&(Mobile_NumKeys[y][1]))) : pgm_read_byte(&(Mobile_KB_Capitals[y][1])) ))
-          break;
-
-        if (IsTouchWithin(8 + (23 * (x - 3)) + ShiftRight, kTextAreaHeight + (30 * y), 20,25))
-        {// this will draw the button on the screen by so many pixels
-          if (bufIndex < (kWifiSsidPasswordLengthMax))
-          {
-            delay(100);
-            char pressed_char = 0;
-
-            if (GetKeyboardPress_numpad) {
-              if (GetKeyboardPress_shift)
-                pressed_char = pgm_read_byte(&(Mobile_SymKeys[y][x]));
-              else
-                pressed_char = pgm_read_byte(&(Mobile_NumKeys[y][x]));
-            }
-            else {
-              if (GetKeyboardPress_shift)
-                pressed_char = pgm_read_byte(&(Mobile_KB_Capitals[y][x]));
-              else
-                pressed_char = pgm_read_byte(&(Mobile_KB_Smalls[y][x]));
-            }
-              //pressed_char = (pgm_read_byte(&(Mobile_KB_Capitals[y][x])) + (GetKeyboardPress_shift ? 0 : ('a' - 'A')));
-
-            textBuffer[bufIndex] = pressed_char;
-
-            tft.setTextColor(kTextRegularColor, kKeyboardButtonFillColor);
-            DrawKeyboardButton(8 + (23 * (x - 3)) + ShiftRight, kTextAreaHeight + (30 * y), 20,25); // this will draw the button on the screen by so many pixels
-            tft.setCursor(12 + (23 * (x - 3)) + ShiftRight, kTextAreaHeight+5 + (30 * y));
-            tft.print(pressed_char);
-
-            bufIndex++;
-          }
-          break;
-        }
+      SwitchKeyboardLayout();
+      // shift key label depends on numpad
+      DrawKeyboardSpecialKey(kKeyboardShift, /* pressed = */ false);
+      break;
+    case kKeyboardSpace:
+      if(bufIndex < kWifiSsidPasswordLengthMax) {
+        textBuffer[bufIndex++] = ' ';
+        textBuffer[bufIndex] = '\0';
+        DrawKeyboardText(textBuffer, /* clear = */ false);
       }
-    }
-
-    // Spacebar
-    if (!kb_numbers_only && !kb_capitals_only && IsTouchWithin(40, kTextAreaHeight + 90, 140, 25))
-    {
-      textBuffer[bufIndex++] = ' ';
-      delay(100);
-      DrawKeyboardButton(40, kTextAreaHeight + 90, 140, 25);
-      tft.setCursor(58, kTextAreaHeight + 95);
-      tft.print(F("SPACE BAR"));
-    }
-
-    // Delete / BackSpace
-    if (IsTouchWithin(250, kTextAreaHeight + 0, 50, 25))
-    {
-      if ((bufIndex) > 0)
+      break;
+    case kKeyboardDelete:
+      if(bufIndex > 0)
         bufIndex--;
-      textBuffer[bufIndex] = 0;
-      // clear writing pad
-      tft.fillRect(15, kTextAreaHeight - 30, tft.width() - 40, 20, kDisplayBackroundColor);
-      delay(100);
-      DrawKeyboardButton(250, kTextAreaHeight + 0, 50, 25);
-      tft.setCursor(254, kTextAreaHeight + 5);
-      tft.setTextColor(kTextRegularColor, kKeyboardButtonFillColor);
-      tft.print(F("DEL"));
-    }
-
-    // Enter
-    if (IsTouchWithin(240, kTextAreaHeight + 30, 70, 25))
-    {
-      // Serial.println(textBuffer);
+      textBuffer[bufIndex] = '\0';
+      DrawKeyboardText(textBuffer, /* clear = */ true);
+      break;
+    case kKeyboardEnter:
       strcpy(textReturn, textBuffer);
-      while (bufIndex > 0)
-      {
-        bufIndex--;
-        textBuffer[bufIndex] = 0;
-      }
-      // clear writing pad
-      tft.fillRect(15, kTextAreaHeight - 30, tft.width() - 40, 20, kDisplayBackroundColor);
-      delay(100);
-      DrawKeyboardButton(240, kTextAreaHeight + 30, 70, 25);
-      tft.setCursor(244, kTextAreaHeight + 35);
-      tft.print(F("ENTER"));
-    }
+      textBuffer[0] = '\0';
+      DrawKeyboardText(textBuffer, /* clear = */ true);
+      break;
   }
-  tft.setTextColor(kTextRegularColor, kKeyboardButtonFillColor);
-  tft.setCursor(15, kTextAreaHeight - 30);
-  tft.print(textBuffer);
-  // Serial.println(textBuffer);
   return true;
 }
 
@@ -2122,17 +2614,13 @@ bool RGBDisplay::GetUserOnScreenTextInput(std::string label, char* return_text,
   if(kb_numbers_only) {
     // Numpad Input
     GetKeyboardPress_shift = false;
-    GetKeyboardPress_lastShift = false;
     GetKeyboardPress_numpad = true;
-    GetKeyboardPress_lastNumpad = true;
     MakeKeyboard(Mobile_NumKeys, label);
   }
   else {
     // Keypad Input
     GetKeyboardPress_shift = true;
-    GetKeyboardPress_lastShift = true;
     GetKeyboardPress_numpad = false;
-    GetKeyboardPress_lastNumpad = false;
     MakeKeyboard(Mobile_KB_Capitals, label);
   }
 
@@ -2140,12 +2628,24 @@ bool RGBDisplay::GetUserOnScreenTextInput(std::string label, char* return_text,
   char user_input_buffer[kWifiSsidPasswordLengthMax + 1] = "";
   strcpy(user_input_buffer, return_text);
   strcpy(return_text, "");
+  DrawKeyboardText(user_input_buffer, /* clear = */ false);
+
+  // touch that opened keyboard is not a key press
+  keyboard_touch_down_ = true;
+  keyboard_pressed_key_ = -1;
+  keyboard_pressed_special_key_ = -1;
 
   // get user input
   while(1) {
     ResetWatchdog();
     inactivity_millis = 0;
 
+    // sleep until touch interrupt, while touched poll for release
+    if(keyboard_touch_down_)
+      delay(kKeyboardReleasePollMs);
+    else
+      ts->WaitForTouch(kKeyboardTouchWaitMs);
+
     // See if there's any  touch data for us
     ret = GetKeyboardPress(user_input_buffer, label, return_text);
 
@@ -2154,9 +2654,9 @@ bool RGBDisplay::GetUserOnScreenTextInput(std::string label, char* return_text,
       break;
 
     //print the text
-    tft.setCursor(10,30);
-    tft.println(return_text);
     if(strcmp(return_text, "") != 0) {
+      tft.setCursor(10,30);
+      tft.println(return_text);
       PrintLn(return_text);
       delay(1000);
       break;
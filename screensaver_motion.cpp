@@ -0,0 +1,146 @@
+#include "screensaver_motion.h"
+#include "fixed_trig.h"
+
+void ScreensaverMotion::Reset(int16_t x, int16_t y) {
+  x_ = (int32_t)x << 8;
+  y_ = (int32_t)y << 8;
+  vx_ = (int32_t)speed_ << 8;
+  vy_ = (int32_t)speed_ << 8;
+  x_rem_ = 0;
+  y_rem_ = 0;
+  phase_from_position_ = true;
+}
+
+void ScreensaverMotion::SetTrajectory(ScreensaverTrajectory trajectory) {
+  if(trajectory == kScreensaverLissajous && trajectory_ != kScreensaverLissajous)
+    phase_from_position_ = true;
+  trajectory_ = trajectory;
+}
+
+void ScreensaverMotion::SetSpeed(uint16_t px_per_s) {
+  speed_ = px_per_s;
+  vx_ = (vx_ < 0 ? -1 : 1) * ((int32_t)speed_ << 8);
+  vy_ = (vy_ < 0 ? -1 : 1) * ((int32_t)speed_ << 8);
+}
+
+void ScreensaverMotion::SetBounds(int16_t x_min, int16_t x_max, int16_t y_min, int16_t y_max) {
+  x_min_ = x_min;
+  x_max_ = max(x_min, x_max);
+  y_min_ = y_min;
+  y_max_ = max(y_min, y_max);
+}
+
+void ScreensaverMotion::SetFlyWrap(int16_t wrap_at, int16_t wrap_by) {
+  wrap_at_ = wrap_at;
+  wrap_by_ = wrap_by;
+}
+
+bool ScreensaverMotion::Step(uint16_t dt_ms) {
+  dt_ms = min(dt_ms, kMaxStepMs);
+  if(trajectory_ == kScreensaverLissajous)
+    return StepLissajous(dt_ms);
+  return StepLinear(dt_ms);
+}
+
+// Q8.8 px moved in dt_ms at Q8.8 px/s velocity, part of a px x ms that does not make a
+// Q8.8 step is carried in remainder to the next step
+int32_t ScreensaverMotion::AxisStep(int32_t velocity, uint16_t dt_ms, int32_t* remainder) {
+  int32_t moved = velocity * dt_ms + *remainder;
+  *remainder = moved % 1000;
+  return moved / 1000;
+}
+
+bool ScreensaverMotion::StepLinear(uint16_t dt_ms) {
+  x_ += AxisStep(vx_, dt_ms, &x_rem_);
+  y_ += AxisStep(vy_, dt_ms, &y_rem_);
+
+  // left and right edge - only change direction
+  if(x_ <= ((int32_t)x_min_ << 8)) {
+    if(vx_ < 0) {
+      vx_ = -vx_;
+      x_rem_ = 0;
+    }
+  }
+  else if(x_ >= ((int32_t)x_max_ << 8)) {
+    if(trajectory_ == kScreensaverBounce) {
+      if(vx_ > 0) {
+        vx_ = -vx_;
+        x_rem_ = 0;
+      }
+    }
+    else if(x_ >= ((int32_t)wrap_at_ << 8))   // fly through right edge and appear back on left
+      x_ -= (int32_t)wrap_by_ << 8;
+  }
+
+  // top and bottom edge
+  bool vertical_edge_hit = false;
+  if(y_ <= ((int32_t)y_min_ << 8)) {
+    if(vy_ < 0) {
+      vy_ = -vy_;
+      y_rem_ = 0;
+      vertical_edge_hit = true;
+    }
+  }
+  else if(y_ >= ((int32_t)y_max_ << 8)) {
+    if(vy_ > 0) {
+      vy_ = -vy_;
+      y_rem_ = 0;
+      vertical_edge_hit = true;
+    }
+  }
+  return vertical_edge_hit;
+}
+
+/*! @brief  Lissajous drift: x and y are sines over the bounds, y at about 0.707 of x frequency,
+            so the canvas sweeps the whole range without retracing one path. Phase rate is set
+            so that peak speed along the longer axis is speed_. Turning at top or bottom counts
+            as a vertical edge hit.
+*/
+bool ScreensaverMotion::StepLissajous(uint16_t dt_ms) {
+  int32_t amplitude_x = (int32_t)(x_max_ - x_min_) << 7;   // Q8.8 half range
+  int32_t amplitude_y = (int32_t)(y_max_ - y_min_) << 7;
+  uint32_t amplitude_px = (uint32_t)max(amplitude_x, amplitude_y) >> 8;
+  if(amplitude_px == 0)
+    return false;
+
+  // peak speed = amplitude x 2 pi x turns per second, phase turn is 2^32
+  uint32_t phase_step = (uint32_t)((((uint64_t)speed_ * dt_ms) << 32) / (6283u * amplitude_px));
+  if(phase_from_position_) {
+    // phases whose sines are at current position, on the side of the turn moving the way it moves
+    phase_x_ = PhaseAt(x_ - ((int32_t)x_min_ << 8) - amplitude_x, amplitude_x, vx_ >= 0);
+    phase_y_ = PhaseAt(y_ - ((int32_t)y_min_ << 8) - amplitude_y, amplitude_y, vy_ >= 0);
+    phase_from_position_ = false;
+  }
+  uint8_t old_quadrant = phase_y_ >> 30;
+  phase_x_ += phase_step;
+  phase_y_ += (uint32_t)(((uint64_t)phase_step * kLissajousYRate) >> 8);
+  uint8_t new_quadrant = phase_y_ >> 30;
+
+  x_ = ((int32_t)x_min_ << 8) + amplitude_x + ((amplitude_x * SineQ15(phase_x_ >> 16)) >> 15);
+  y_ = ((int32_t)y_min_ << 8) + amplitude_y + ((amplitude_y * SineQ15(phase_y_ >> 16)) >> 15);
+  // linear motion continues the way lissajous moves after a switch back
+  vx_ = (CosineQ15(phase_x_ >> 16) < 0 ? -1 : 1) * ((int32_t)speed_ << 8);
+  vy_ = (CosineQ15(phase_y_ >> 16) < 0 ? -1 : 1) * ((int32_t)speed_ << 8);
+
+  // sine turns at 90 and 270 degrees, bottom and top of range
+  return (old_quadrant != new_quadrant && (new_quadrant == 1 || new_quadrant == 3));
+}
+
+// phase of a sine of amplitude at offset from its middle, offsets past amplitude clamp to the
+// turning point; rising half of the turn if increasing, falling half if not
+uint32_t ScreensaverMotion::PhaseAt(int32_t offset, int32_t amplitude, bool increasing) {
+  if(amplitude <= 0)
+    return 0;
+  int32_t target_q15 = (int32_t)(((int64_t)max(min(offset, amplitude), -amplitude) << 15) / amplitude);
+  // sine rises over -90 to 90 degrees, binary search there
+  int32_t lo = -0x4000, hi = 0x4000;
+  while(lo < hi) {
+    int32_t mid = (lo + hi) >> 1;
+    if(SineQ15((uint16_t)mid) < target_q15)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  int32_t angle = (increasing ? lo : 0x8000 - lo);
+  return (uint32_t)(uint16_t)angle << 16;
+}
@@ -0,0 +1,70 @@
+#ifndef SCREENSAVER_MOTION_H
+#define SCREENSAVER_MOTION_H
+
+#include "common.h"
+
+enum ScreensaverTrajectory {
+  kScreensaverBounce,         // bounce off all edges
+  kScreensaverFlyThrough,     // bounce off top and bottom, fly out of right edge back in on left
+  kScreensaverLissajous,      // slow drift over whole range, never retraces its path for long
+};
+
+// Time based screensaver motion. Positions are Q8.8 px and velocities Q8.8 px/s, so motion
+// speed does not depend on frame rate, and slow speeds at low frame rates move in whole
+// pixels only when enough sub-pixel motion has added up.
+class ScreensaverMotion {
+
+public:
+
+  // top left corner position in px, moving right and down
+  void Reset(int16_t x, int16_t y);
+
+  // speed along each axis, lissajous speed is peak speed along longer axis
+  void SetSpeed(uint16_t px_per_s);
+  void SetTrajectory(ScreensaverTrajectory trajectory);
+
+  // range of top left corner, edges are hit at the limits
+  void SetBounds(int16_t x_min, int16_t x_max, int16_t y_min, int16_t y_max);
+
+  // fly through moves x back by wrap_by once it reaches wrap_at
+  void SetFlyWrap(int16_t wrap_at, int16_t wrap_by);
+
+  // advance by dt_ms, returns true if top or bottom edge was hit
+  bool Step(uint16_t dt_ms);
+
+  int16_t x() const { return x_ >> 8; }
+  int16_t y() const { return y_ >> 8; }
+
+private:
+
+  // longest step, a stalled loop should not make canvas jump across screen
+  constexpr static uint16_t kMaxStepMs = 100;
+
+  // lissajous y phase rate relative to x in 1/256, close to 1/sqrt(2) so path does not close soon
+  constexpr static uint16_t kLissajousYRate = 181;
+
+  ScreensaverTrajectory trajectory_ = kScreensaverBounce;
+
+  // Q8.8 px and px/s, velocity sign is direction
+  int32_t x_ = 0, y_ = 0;
+  int32_t vx_ = 0, vy_ = 0;
+  // Q8.8 px x ms not yet moved, keeps position exact over many short steps
+  int32_t x_rem_ = 0, y_rem_ = 0;
+  uint16_t speed_ = 0;
+
+  int16_t x_min_ = 0, x_max_ = 0, y_min_ = 0, y_max_ = 0;
+  int16_t wrap_at_ = 0, wrap_by_ = 0;
+
+  // lissajous phases, a full turn is 2^32; taken from position on next lissajous step after
+  // Reset or a switch to lissajous, so canvas continues from where it is
+  uint32_t phase_x_ = 0, phase_y_ = 0;
+  bool phase_from_position_ = true;
+
+  static int32_t AxisStep(int32_t velocity, uint16_t dt_ms, int32_t* remainder);
+  static uint32_t PhaseAt(int32_t offset, int32_t amplitude, bool increasing);
+  bool StepLinear(uint16_t dt_ms);
+  bool StepLissajous(uint16_t dt_ms);
+
+};
+
+#endif  // SCREENSAVER_MOTION_H
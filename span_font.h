@@ -0,0 +1,28 @@
+#ifndef SPAN_FONT_H
+#define SPAN_FONT_H
+
+#include <stdint.h>
+
+// Glyph of a span encoded font. Each of its h rows starts with a run count followed by
+// (skip, length) byte pairs, skip counts clear pixels since the end of the previous run.
+struct SpanGlyph {
+  uint16_t offset;      // of first row in SpanFont::data
+  uint8_t w;
+  uint8_t h;
+  uint8_t x_advance;
+  int8_t x_offset;
+  int8_t y_offset;
+};
+
+// Span encoded counterpart of GFXfont for big, mostly solid glyphs such as the clock digits.
+// Generated from GFXfont headers by tools/gfxfont_to_spanfont.py, characters between first and
+// last that were not converted have an empty glyph.
+struct SpanFont {
+  const uint8_t* data;
+  const SpanGlyph* glyph;
+  uint8_t first;
+  uint8_t last;
+  uint8_t y_advance;
+};
+
+#endif  // SPAN_FONT_H
@@ -0,0 +1,87 @@
+#include "sprite_compositor.h"
+
+void SpriteCompositor::SetSize(int16_t w, int16_t h) {
+  w_ = w;
+  h_ = h;
+}
+
+void SpriteCompositor::SetSprite(uint8_t index, const uint8_t* bitmap, int16_t x, int16_t y, int16_t w, int16_t h) {
+  if(index >= kMaxSprites)
+    return;
+  sprites_[index] = {bitmap, x, y, w, h};
+}
+
+void SpriteCompositor::ClearSprite(uint8_t index) {
+  if(index < kMaxSprites)
+    sprites_[index].bitmap = NULL;
+}
+
+void SpriteCompositor::ClearSprites() {
+  for(uint8_t i = 0; i < kMaxSprites; i++)
+    sprites_[i].bitmap = NULL;
+}
+
+void SpriteCompositor::ComposeRowBits(int16_t y, int16_t offset, uint8_t* out_bits, int16_t out_w) const {
+  memset(out_bits, 0, (out_w + 7) >> 3);
+  if(y < 0 || y >= h_)
+    return;
+
+  for(uint8_t i = 0; i < kMaxSprites; i++) {
+    const Sprite& sprite = sprites_[i];
+    if(sprite.bitmap == NULL || y < sprite.y || y >= sprite.y + sprite.h)
+      continue;
+    // output bits of sprite pixels that lie within composite
+    int16_t k0 = max((int16_t)(max(sprite.x, (int16_t)0) + offset), (int16_t)0);
+    int16_t k1 = min((int16_t)(min((int16_t)(sprite.x + sprite.w), w_) + offset), out_w);
+    if(k0 >= k1)
+      continue;
+    int16_t row_bytes = (sprite.w + 7) >> 3;
+    OrRowBits(&sprite.bitmap[(y - sprite.y) * row_bytes], row_bytes, k0 - offset - sprite.x, k0, k1, out_bits);
+  }
+
+  if(border_) {
+    int16_t k0 = max(offset, (int16_t)0), k1 = min((int16_t)(offset + w_), out_w);
+    if(y == 0 || y == h_ - 1)
+      SetRowBits(k0, k1, out_bits);
+    else {
+      if(offset >= 0 && offset < out_w)
+        SetRowBits(offset, offset + 1, out_bits);
+      if(offset + w_ - 1 >= 0 && offset + w_ - 1 < out_w)
+        SetRowBits(offset + w_ - 1, offset + w_, out_bits);
+    }
+  }
+}
+
+bool SpriteCompositor::GetPixel(int16_t x, int16_t y) const {
+  uint8_t bits;
+  ComposeRowBits(y, -x, &bits, 1);
+  return bits & 0x80;
+}
+
+// OR row bits from src_start on into output bits [k0, k1), a whole output byte at a time
+void SpriteCompositor::OrRowBits(const uint8_t* row, int16_t row_bytes, int16_t src_start, int16_t k0, int16_t k1, uint8_t* out_bits) {
+  int16_t shift = src_start - k0;     // row bit of output bit k is k + shift
+  for(int16_t b = k0 >> 3; b <= (k1 - 1) >> 3; b++) {
+    int16_t src = (b << 3) + shift;
+    uint8_t val;
+    if(src < 0)
+      val = row[0] >> (-src);         // only first output byte, bits before k0 are masked off
+    else {
+      uint8_t bit = src & 7;
+      int16_t byte = src >> 3;
+      val = row[byte] << bit;
+      if(bit && byte + 1 < row_bytes)
+        val |= row[byte + 1] >> (8 - bit);
+    }
+    int16_t lo = max((int16_t)(k0 - (b << 3)), (int16_t)0), hi = min((int16_t)(k1 - (b << 3)), (int16_t)8);
+    out_bits[b] |= val & (uint8_t)((0xFF >> lo) & (0xFF << (8 - hi)));
+  }
+}
+
+// set output bits [k0, k1)
+void SpriteCompositor::SetRowBits(int16_t k0, int16_t k1, uint8_t* out_bits) {
+  for(int16_t b = k0 >> 3; b <= (k1 - 1) >> 3 && k0 < k1; b++) {
+    int16_t lo = max((int16_t)(k0 - (b << 3)), (int16_t)0), hi = min((int16_t)(k1 - (b << 3)), (int16_t)8);
+    out_bits[b] |= (uint8_t)((0xFF >> lo) & (0xFF << (8 - hi)));
+  }
+}
@@ -0,0 +1,51 @@
+#ifndef SPRITE_COMPOSITOR_H
+#define SPRITE_COMPOSITOR_H
+
+#include "common.h"
+
+// 1-bit bitmap with byte aligned rows, leftmost pixel in the high bit, placed with its top left
+// corner at (x, y) of the composite
+struct Sprite {
+  const uint8_t* bitmap;
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+};
+
+// A w x h 1-bit image made of sprites ORed over each other and an optional 1 px border. It is
+// never stored whole: rows are composed as they are sent to the display, so each sprite is
+// rendered once and kept until its own contents change, and moving a sprite costs nothing.
+class SpriteCompositor {
+
+public:
+
+  static const uint8_t kMaxSprites = 4;
+
+  void SetSize(int16_t w, int16_t h);
+  int16_t width() const { return w_; }
+  int16_t height() const { return h_; }
+
+  void SetSprite(uint8_t index, const uint8_t* bitmap, int16_t x, int16_t y, int16_t w, int16_t h);
+  void ClearSprite(uint8_t index);
+  void ClearSprites();
+  void SetBorder(bool border) { border_ = border; }
+
+  // same contract as RGBDisplay::ExtractCanvasRowBits: output bit k is composite bit (k - offset)
+  // of row y, 0 outside the composite
+  void ComposeRowBits(int16_t y, int16_t offset, uint8_t* out_bits, int16_t out_w) const;
+
+  bool GetPixel(int16_t x, int16_t y) const;
+
+private:
+
+  Sprite sprites_[kMaxSprites] = {};
+  int16_t w_ = 0, h_ = 0;
+  bool border_ = false;
+
+  static void OrRowBits(const uint8_t* row, int16_t row_bytes, int16_t src_start, int16_t k0, int16_t k1, uint8_t* out_bits);
+  static void SetRowBits(int16_t k0, int16_t k1, uint8_t* out_bits);
+
+};
+
+#endif  // SPRITE_COMPOSITOR_H
@@ -0,0 +1,164 @@
+// Host test of AmbientLight filtering and hysteresis. Light traces are replayed through
+// AddSample() with the display's brightness curve and the published brightness is checked.
+// Built traces model an LDR divider: ADC noise, single sample spikes, a light switched on,
+// a dusk ramp, slow lamp flicker around a curve point and full scale. Readings recorded on a
+// device, one raw 12-bit reading per line at the 100 ms sample rate, are replayed and
+// summarized when given as arguments.
+//
+// usage (from the sketch directory):
+//   g++ -std=gnu++17 -Wall -Wextra -o /tmp/ambient_light_test tools/ambient_light_test.cpp && /tmp/ambient_light_test [trace.txt ...]
+//
+// Exits nonzero if a check fails.
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cmath>
+#include <vector>
+
+// ambient_light.cpp only needs the ADC read from the Arduino core when no MCU is defined
+#define COMMON_H
+static uint16_t trace_raw = 0;
+static uint16_t analogRead(int) { return trace_raw; }
+
+#include "../ambient_light.cpp"
+
+// same as RGBDisplay::kAmbientLightCurve
+const AmbientLightPoint kCurve[7] = {{248, 1}, {400, 3}, {640, 8}, {1024, 20}, {1640, 45}, {2600, 90}, {4095, 150}};
+const uint8_t kCurvePoints = sizeof(kCurve) / sizeof(kCurve[0]);
+
+// repeatable noise
+static uint32_t lcg_state = 12345;
+static int32_t Noise(int32_t amplitude) {
+  lcg_state = lcg_state * 1103515245 + 12345;
+  return (int32_t)((lcg_state >> 16) % (2 * amplitude + 1)) - amplitude;
+}
+
+static uint16_t Clamp(int32_t raw) {
+  return (uint16_t)(raw < 0 ? 0 : (raw > AmbientLight::kRawMax ? AmbientLight::kRawMax : raw));
+}
+
+// brightness published while a trace is replayed, first reading settles the filters as Begin does
+struct Replay {
+  std::vector<uint8_t> brightness;
+  uint32_t changes;
+};
+
+static Replay Run(const std::vector<uint16_t>& trace) {
+  AmbientLight ambient_light;
+  trace_raw = trace[0];
+  ambient_light.Begin(0, kCurve, kCurvePoints);
+  Replay replay;
+  for(size_t i = 1; i < trace.size(); i++) {
+    ambient_light.AddSample(trace[i]);
+    replay.brightness.push_back(ambient_light.brightness());
+  }
+  replay.changes = ambient_light.changes();
+  return replay;
+}
+
+// brightness of a steady reading
+static uint8_t Steady(uint16_t raw) {
+  AmbientLight ambient_light;
+  trace_raw = raw;
+  ambient_light.Begin(0, kCurve, kCurvePoints);
+  return ambient_light.brightness();
+}
+
+static int failures = 0;
+
+static void Check(bool ok, const char* trace_name, const char* what) {
+  printf("%-24s %-52s %s\n", trace_name, what, ok ? "ok" : "FAIL");
+  if(!ok)
+    failures++;
+}
+
+int main(int argc, char** argv) {
+  // 2% ADC noise on a steady reading
+  {
+    std::vector<uint16_t> trace;
+    for(int i = 0; i < 600; i++)
+      trace.push_back(Clamp(1000 + Noise(20)));
+    Check(Run(trace).changes == 0, "noise", "no brightness change");
+  }
+
+  // single sample spikes to both rails every 2 s
+  {
+    std::vector<uint16_t> trace;
+    for(int i = 0; i < 600; i++)
+      trace.push_back(i % 20 == 7 ? AmbientLight::kRawMax : (i % 20 == 17 ? 0 : Clamp(1000 + Noise(10))));
+    Check(Run(trace).changes == 0, "spikes", "no brightness change");
+  }
+
+  // light switched on, settles within a hysteresis step of the new reading in 3 s
+  {
+    std::vector<uint16_t> trace;
+    for(int i = 0; i < 100; i++)
+      trace.push_back(Clamp((i < 20 ? 400 : 2600) + Noise(10)));
+    Replay replay = Run(trace);
+    uint8_t settled = replay.brightness[20 + 30];
+    bool stays = true;
+    for(size_t i = 20 + 30; i < replay.brightness.size(); i++)
+      stays = stays && (replay.brightness[i] == settled);
+    Check(settled >= Steady(2600 * pow(2, -0.25)) && settled <= Steady(2600), "step 400 to 2600", "settles near new reading in 3 s");
+    Check(stays, "step 400 to 2600", "no change after settling");
+  }
+
+  // dusk, reading falls from 2600 to 248 over 10 minutes
+  {
+    std::vector<uint16_t> trace;
+    for(int i = 0; i <= 6000; i++)
+      trace.push_back(Clamp(2600 * pow(248.0 / 2600, i / 6000.0) + Noise(8)));
+    Replay replay = Run(trace);
+    bool falling = true;
+    for(size_t i = 1; i < replay.brightness.size(); i++)
+      falling = falling && (replay.brightness[i] <= replay.brightness[i - 1]);
+    // a change every quarter of a halving of reading at most
+    uint32_t max_changes = (uint32_t)ceil(4 * log2(2600.0 / 248));
+    Check(falling, "dusk ramp", "brightness never goes up");
+    Check(replay.changes <= max_changes, "dusk ramp", "at most one change per hysteresis step");
+    Check(replay.brightness.back() == kCurve[0].brightness, "dusk ramp", "ends at curve start");
+  }
+
+  // lamp flicker, reading swings 5% around a curve point every 4 s
+  {
+    std::vector<uint16_t> trace;
+    for(int i = 0; i < 1200; i++)
+      trace.push_back(Clamp(1024 * (1 + 0.05 * sin(2 * M_PI * i / 40)) + Noise(5)));
+    Check(Run(trace).changes == 0, "flicker around 1024", "no brightness change");
+  }
+
+  // full scale, past the curve end there is no hysteresis to hold brightness below its end
+  {
+    std::vector<uint16_t> trace;
+    for(int i = 0; i < 100; i++)
+      trace.push_back(Clamp((i < 20 ? 3000 : AmbientLight::kRawMax) - (i < 20 ? 0 : Noise(5) + 5)));
+    Replay replay = Run(trace);
+    Check(replay.brightness.back() == kCurve[kCurvePoints - 1].brightness, "full scale", "reaches curve end");
+  }
+
+  // recorded traces
+  for(int arg = 1; arg < argc; arg++) {
+    FILE* file = fopen(argv[arg], "r");
+    if(file == NULL) {
+      printf("%s: cannot open\n", argv[arg]);
+      failures++;
+      continue;
+    }
+    std::vector<uint16_t> trace;
+    unsigned int raw;
+    while(fscanf(file, "%u", &raw) == 1)
+      trace.push_back(Clamp(raw));
+    fclose(file);
+    if(trace.size() < 2) {
+      printf("%s: fewer than 2 readings\n", argv[arg]);
+      failures++;
+      continue;
+    }
+    Replay replay = Run(trace);
+    printf("%s: %zu samples, %u brightness changes, brightness %u to %u\n", argv[arg], trace.size(), replay.changes, Steady(trace[0]), replay.brightness.back());
+  }
+
+  printf(failures == 0 ? "PASS\n" : "FAIL\n");
+  return (failures == 0 ? 0 : 1);
+}
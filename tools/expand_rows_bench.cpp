@@ -0,0 +1,164 @@
+// Host benchmark of 1-bit to RGB565 row expansion, the inner loop of FastDrawTwoColorBitmapSpi.
+// The per bit loop the blit used before its nibble lookup table is timed against
+// RGBDisplay::ExpandTwoColorRow on whole canvases of random pixels: the screensaver canvas
+// (about 280x150 on a 320x240 panel) and full screens of the supported panels. Every canvas is
+// also expanded left clipped by 3 pixels, as the screensaver is when it crosses the left edge,
+// which takes the unaligned head path. Both kernels must produce the same pixels.
+//
+// usage (from the sketch directory):
+//   g++ -std=gnu++17 -O2 -Wall -Wextra -o /tmp/expand_rows_bench tools/expand_rows_bench.cpp && /tmp/expand_rows_bench [WxH ...]
+//
+// Canvas sizes given as arguments replace the built in ones, the render benchmark ('B' on serial)
+// times the same pair on the device at the screensaver canvas size it prints.
+// Exits nonzero if the kernels differ.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+// same as RGBDisplay::BuildNibbleLut
+static void BuildNibbleLut(uint16_t nibble_lut[16][4], uint16_t color, uint16_t bg) {
+  for (uint8_t nibble = 0; nibble < 16; nibble++)
+    for (uint8_t bit = 0; bit < 4; bit++)
+      nibble_lut[nibble][bit] = (((nibble >> (3 - bit)) & 0x01) ? color : bg);
+}
+
+// same as RGBDisplay::ExpandTwoColorRow
+static void ExpandTwoColorRow(const uint8_t* bitmap_row, int16_t bit_start, int16_t bit_end, uint16_t* row_buffer, const uint16_t nibble_lut[16][4]) {
+  int16_t i = bit_start;
+  // unaligned head, pixel by pixel up to the next byte boundary
+  if (i & 7) {
+    uint8_t currentByte = bitmap_row[i >> 3];
+    int16_t head_end = std::min(bit_end, (int16_t)((i | 7) + 1));
+    for (; i < head_end; i++)
+      *row_buffer++ = nibble_lut[((currentByte >> (7 - (i & 7))) & 0x01) ? 0x0F : 0x00][0];
+  }
+  // aligned body, 8 pixels per bitmap byte
+  for (; i + 8 <= bit_end; i += 8) {
+    uint8_t currentByte = bitmap_row[i >> 3];
+    memcpy(row_buffer, nibble_lut[currentByte >> 4], 4 * sizeof(uint16_t));
+    memcpy(row_buffer + 4, nibble_lut[currentByte & 0x0F], 4 * sizeof(uint16_t));
+    row_buffer += 8;
+  }
+  // tail, remaining pixels of the last partial byte
+  if (i < bit_end) {
+    uint8_t currentByte = bitmap_row[i >> 3];
+    for (; i < bit_end; i++)
+      *row_buffer++ = nibble_lut[((currentByte >> (7 - (i & 7))) & 0x01) ? 0x0F : 0x00][0];
+  }
+}
+
+// same as ExpandTwoColorRowPerBit of rgb_display_benchmark.cpp, the loop of FastDrawTwoColorBitmapSpi
+// before the nibble LUT
+static void ExpandTwoColorRowPerBit(const uint8_t* bitmap_row, int16_t bit_start, int16_t bit_end, uint16_t* row_buffer, uint16_t color, uint16_t bg) {
+  uint8_t currentByte = bitmap_row[bit_start >> 3];
+  for (int16_t i = bit_start; i < bit_end; i++) {
+    uint8_t bitIndex = 7 - i % 8;
+    if (bitIndex == 7)  // new byte
+      currentByte = bitmap_row[i >> 3];
+    *row_buffer++ = (((currentByte >> bitIndex) & 0x01) ? color : bg);
+  }
+}
+
+struct CanvasSize {
+  int16_t w;
+  int16_t h;
+  const char* name;
+};
+
+const CanvasSize kCanvasSizes[] = {
+  {280, 150, "screensaver canvas 320x240"},
+  {160, 128, "ST7735 screen"},
+  {320, 240, "ST7789V / ILI9341 screen"},
+  {480, 320, "ST7796 / ILI9488 screen"},
+};
+
+const uint16_t kColor = 0xFD20, kBg = 0x0000;
+const int kFramesPerBatch = 200;
+const int kBatches = 7;
+
+// repeatable pixels, about half of them lit
+static uint32_t lcg_state = 12345;
+static uint8_t RandomByte() {
+  lcg_state = lcg_state * 1103515245 + 12345;
+  return (uint8_t)(lcg_state >> 16);
+}
+
+static volatile uint16_t expanded_sink;
+
+// expands every row of canvas from bit_start, microseconds per canvas of fastest batch
+template <class Expand>
+static double TimeCanvas(const std::vector<uint8_t>& bitmap, int16_t w, int16_t h, int16_t bit_start, Expand expand) {
+  int16_t width_bytes = (w + 7) >> 3;
+  std::vector<uint16_t> row(w);
+  double best_us = 1e12;
+  for (int batch = 0; batch < kBatches; batch++) {
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < kFramesPerBatch; frame++) {
+      for (int16_t j = 0; j < h; j++) {
+        expand(&bitmap[j * width_bytes], bit_start, w, row.data());
+        expanded_sink = row[j % (w - bit_start)];
+      }
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    best_us = std::min(best_us, elapsed.count() / kFramesPerBatch);
+  }
+  return best_us;
+}
+
+static int failures = 0;
+
+static void RunCanvas(const CanvasSize& size) {
+  int16_t width_bytes = (size.w + 7) >> 3;
+  std::vector<uint8_t> bitmap(width_bytes * size.h);
+  for (uint8_t& byte : bitmap)
+    byte = RandomByte();
+  uint16_t nibble_lut[16][4];
+  BuildNibbleLut(nibble_lut, kColor, kBg);
+
+  for (int16_t bit_start : {(int16_t)0, (int16_t)3}) {
+    // same pixels from both kernels
+    std::vector<uint16_t> per_bit(size.w), nibble(size.w);
+    bool same = true;
+    for (int16_t j = 0; j < size.h; j++) {
+      ExpandTwoColorRowPerBit(&bitmap[j * width_bytes], bit_start, size.w, per_bit.data(), kColor, kBg);
+      ExpandTwoColorRow(&bitmap[j * width_bytes], bit_start, size.w, nibble.data(), nibble_lut);
+      same = same && (memcmp(per_bit.data(), nibble.data(), (size.w - bit_start) * sizeof(uint16_t)) == 0);
+    }
+    if (!same)
+      failures++;
+
+    double per_bit_us = TimeCanvas(bitmap, size.w, size.h, bit_start, [](const uint8_t* bitmap_row, int16_t bit_start, int16_t bit_end, uint16_t* row_buffer) {
+      ExpandTwoColorRowPerBit(bitmap_row, bit_start, bit_end, row_buffer, kColor, kBg);
+    });
+    double nibble_us = TimeCanvas(bitmap, size.w, size.h, bit_start, [&nibble_lut](const uint8_t* bitmap_row, int16_t bit_start, int16_t bit_end, uint16_t* row_buffer) {
+      ExpandTwoColorRow(bitmap_row, bit_start, bit_end, row_buffer, nibble_lut);
+    });
+    printf("%4dx%-4d %-28s %-6s %9.1f %9.1f %6.1fx  %s\n", size.w, size.h, size.name, (bit_start == 0 ? "whole" : "clip 3"),
+      per_bit_us, nibble_us, per_bit_us / nibble_us, same ? "ok" : "DIFFER");
+  }
+}
+
+int main(int argc, char** argv) {
+  printf("%-38s %-6s %9s %9s %7s\n", "canvas", "rows", "bit us", "LUT us", "speedup");
+  if (argc > 1) {
+    for (int arg = 1; arg < argc; arg++) {
+      int w, h;
+      if (sscanf(argv[arg], "%dx%d", &w, &h) != 2 || w < 8 || h < 1 || w > 2048 || h > 2048) {
+        printf("%s: expected WxH, 8 <= W <= 2048\n", argv[arg]);
+        failures++;
+        continue;
+      }
+      RunCanvas({(int16_t)w, (int16_t)h, "from arguments"});
+    }
+  }
+  else {
+    for (const CanvasSize& size : kCanvasSizes)
+      RunCanvas(size);
+  }
+  printf(failures == 0 ? "PASS\n" : "FAIL\n");
+  return (failures == 0 ? 0 : 1);
+}
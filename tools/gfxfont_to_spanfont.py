@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""Convert an Adafruit GFXfont header into a span encoded SpanFont header (see span_font.h).
+
+Each glyph row is stored as a run count followed by (skip, length) byte pairs, where skip is
+the number of clear pixels since the end of the previous run. Glyphs of big clock fonts are
+mostly long solid runs, so this is smaller than 1 bit per pixel and can be drawn run by run.
+
+usage: gfxfont_to_spanfont.py Fonts/FreeSansBold48pt7b.h FreeSansBold48pt7b \
+         --chars "0123456789:" -o Fonts/FreeSansBold48pt7b_spans.h
+"""
+
+import argparse
+import re
+import sys
+
+
+def parse_gfxfont(text, name):
+    bitmap_match = re.search(r'const\s+uint8_t\s+' + name + r'Bitmaps\[\]\s*(?:PROGMEM)?\s*=\s*\{(.*?)\};', text, re.S)
+    glyph_match = re.search(r'const\s+GFXglyph\s+' + name + r'Glyphs\[\]\s*(?:PROGMEM)?\s*=\s*\{(.*?)\};', text, re.S)
+    font_match = re.search(r'const\s+GFXfont\s+' + name + r'\s*(?:PROGMEM)?\s*=\s*\{(.*?)\};', text, re.S)
+    if not (bitmap_match and glyph_match and font_match):
+        sys.exit('GFXfont ' + name + ' not found')
+    bitmap = [int(b, 16) for b in re.findall(r'0x[0-9A-Fa-f]{2}', bitmap_match.group(1))]
+    glyphs = [tuple(int(v) for v in g.split(','))
+              for g in re.findall(r'\{\s*(-?\d+\s*(?:,\s*-?\d+\s*){5})\}', glyph_match.group(1))]
+    font_fields = [f.strip() for f in font_match.group(1).split(',')]
+    first, last, y_advance = int(font_fields[2], 0), int(font_fields[3], 0), int(font_fields[4], 0)
+    return bitmap, glyphs, first, last, y_advance
+
+
+def glyph_rows(bitmap, offset, w, h):
+    bit = 0
+    rows = []
+    for _ in range(h):
+        row = []
+        for _ in range(w):
+            row.append((bitmap[offset + (bit >> 3)] >> (7 - (bit & 7))) & 1)
+            bit += 1
+        rows.append(row)
+    return rows
+
+
+def encode_row(row):
+    runs = []
+    x = 0
+    end = 0
+    while x < len(row):
+        if row[x]:
+            start = x
+            while x < len(row) and row[x]:
+                x += 1
+            runs.append((start - end, x - start))
+            end = x
+        else:
+            x += 1
+    if len(runs) > 255 or any(skip > 255 or length > 255 for skip, length in runs):
+        sys.exit('glyph too wide for byte spans')
+    data = [len(runs)]
+    for skip, length in runs:
+        data += [skip, length]
+    return data
+
+
+def span_font_header(header, name, chars=None):
+    """Span encoded SpanFont header text of GFXfont name in header, keeping only chars if given."""
+    with open(header) as f:
+        bitmap, glyphs, font_first, font_last, y_advance = parse_gfxfont(f.read(), name)
+    # reduced size headers keep the original last character but drop trailing glyphs
+    first, last = font_first, min(font_last, font_first + len(glyphs) - 1)
+    if chars:
+        first = min(ord(c) for c in chars)
+        last = max(ord(c) for c in chars)
+        missing = [c for c in chars if not font_first <= ord(c) <= font_first + len(glyphs) - 1]
+        if missing:
+            sys.exit(name + ': characters not in font: ' + ''.join(missing))
+
+    spans = []
+    span_glyphs = []
+    bitmap_bytes = 0
+    for code in range(first, last + 1):
+        offset, w, h, x_advance, x_offset, y_offset = glyphs[code - font_first]
+        if chars and chr(code) not in chars:
+            w = h = x_advance = x_offset = y_offset = 0
+        span_glyphs.append((len(spans), w, h, x_advance, x_offset, y_offset, code))
+        bitmap_bytes += (w * h + 7) // 8
+        for row in glyph_rows(bitmap, offset, w, h):
+            spans += encode_row(row)
+
+    out = []
+    out.append('// ' + name + ' span encoded by tools/gfxfont_to_spanfont.py from ' + header)
+    if chars:
+        out.append('// characters: ' + chars)
+    out.append('// ' + str(len(spans)) + ' span bytes, ' + str(bitmap_bytes) + ' bytes as GFXfont bitmap')
+    out.append('')
+    out.append('const uint8_t ' + name + 'SpanData[] PROGMEM = {')
+    for i in range(0, len(spans), 16):
+        out.append('  ' + ', '.join('0x%02X' % b for b in spans[i:i + 16]) + ',')
+    out.append('  };')
+    out.append('')
+    out.append('const SpanGlyph ' + name + 'SpanGlyphs[] PROGMEM = {')
+    for offset, w, h, x_advance, x_offset, y_offset, code in span_glyphs:
+        out.append('  { %5d, %3d, %3d, %3d, %4d, %4d },   // 0x%02X \'%s\'' % (offset, w, h, x_advance, x_offset, y_offset, code, chr(code)))
+    out.append('  };')
+    out.append('')
+    out.append('const SpanFont ' + name + 'Spans PROGMEM = {')
+    out.append('  ' + name + 'SpanData, ' + name + 'SpanGlyphs, 0x%02X, 0x%02X, %d };' % (first, last, y_advance))
+    out.append('')
+    return '\n'.join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('header', help='GFXfont header')
+    parser.add_argument('name', help='GFXfont name, for example FreeSansBold48pt7b')
+    parser.add_argument('--chars', help='only keep these characters, others become empty glyphs')
+    parser.add_argument('-o', '--output', help='output header, default stdout')
+    args = parser.parse_args()
+
+    text = span_font_header(args.header, args.name, args.chars)
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(text)
+    else:
+        print(text)
+
+
+if __name__ == '__main__':
+    main()
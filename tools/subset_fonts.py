@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+"""Generate subset font headers for the fonts listed in tools/font_subsets.txt.
+
+Firmware sources are scanned for the text each font draws: string literals and k... string
+constants passed to print(), println() and getTextBounds() after setFont() on the same object,
+and GlyphAtlas charsets. Then per font mode:
+
+  full    nothing is generated, every scanned character has to be in the font
+  subset  Fonts/<font>_subset.h is written, a GFXfont of the same name with only the scanned and
+          extra characters, first and last narrowed to them and the bitmap of all other glyphs
+          removed. Text printed at runtime in a subset font needs extra characters in the list
+  spans   Fonts/<font>_spans.h is written by tools/gfxfont_to_spanfont.py for the scanned and
+          extra characters
+
+Exits nonzero if a font draws a character it does not have, draws runtime text without extra
+characters, is missing from the list or, with --check, a generated header is out of date.
+
+usage: tools/subset_fonts.py [--check]      (from the sketch directory)
+"""
+
+import argparse
+import glob
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from gfxfont_to_spanfont import parse_gfxfont, span_font_header  # noqa: E402
+
+MANIFEST = 'tools/font_subsets.txt'
+SOURCES = ['*.ino', '*.cpp', '*.h']
+
+
+class FontUse:
+    def __init__(self):
+        self.chars = set()
+        self.runtime_text = []      # file:line of prints of non literal text
+
+
+def strip_comments(text):
+    """Blank out // and /* */ comments, keeping string literals and line numbers."""
+    out = []
+    i = 0
+    while i < len(text):
+        if text[i] in '"\'':
+            quote = text[i]
+            j = i + 1
+            while j < len(text) and text[j] != quote:
+                j += 2 if text[j] == '\\' else 1
+            out.append(text[i:j + 1])
+            i = j + 1
+        elif text.startswith('//', i):
+            while i < len(text) and text[i] != '\n':
+                i += 1
+        elif text.startswith('/*', i):
+            j = text.find('*/', i + 2)
+            j = len(text) if j < 0 else j + 2
+            out.append('\n' * text.count('\n', i, j))
+            i = j
+        else:
+            out.append(text[i])
+            i += 1
+    return ''.join(out)
+
+
+def unescape(literal):
+    return bytes(literal, 'utf-8').decode('unicode_escape')
+
+
+def first_argument(args):
+    depth = 0
+    in_string = None
+    for i, c in enumerate(args):
+        if in_string:
+            if c == '\\':
+                continue
+            if c == in_string and args[i - 1] != '\\':
+                in_string = None
+        elif c in '"\'':
+            in_string = c
+        elif c == '(':
+            depth += 1
+        elif c == ')':
+            if depth == 0:
+                return args[:i].strip()
+            depth -= 1
+        elif c == ',' and depth == 0:
+            return args[:i].strip()
+    return args.strip()
+
+
+def text_of(argument, constants):
+    """Characters of a literal, F() literal, char literal, string constant or a choice between
+    them with ?:, None if runtime text."""
+    while re.fullmatch(r'\((.*)\)', argument):
+        argument = argument[1:-1].strip()
+    match = re.fullmatch(r'[^?"]*\?\s*([^:"]+|"(?:[^"\\]|\\.)*")\s*:\s*(.+)', argument)
+    if match:
+        first, second = text_of(match.group(1).strip(), constants), text_of(match.group(2).strip(), constants)
+        return None if first is None or second is None else first + second
+    match = re.fullmatch(r'(?:F\()?\s*"((?:[^"\\]|\\.)*)"\s*\)?', argument)
+    if match:
+        return unescape(match.group(1))
+    match = re.fullmatch(r"'((?:[^'\\]|\\.))'", argument)
+    if match:
+        return unescape(match.group(1))
+    return constants.get(argument)
+
+
+def scan_sources():
+    files = sorted(f for pattern in SOURCES for f in glob.glob(pattern))
+    texts = {f: strip_comments(open(f, encoding='utf-8', errors='replace').read()) for f in files}
+
+    constants = {}
+    for text in texts.values():
+        for name, value in re.findall(r'\b(k\w+)\s*\[\s*\d*\s*\]\s*=\s*"((?:[^"\\]|\\.)*)"', text):
+            constants[name] = unescape(value)
+
+    uses = {}
+    call = re.compile(r'\b(\w+)\s*(?:\.|->)\s*(setFont|print|println|getTextBounds)\s*\(')
+    atlas = re.compile(r'\bGlyphAtlas\s*\(\s*&(\w+?)(?:Spans)?\s*,\s*"((?:[^"\\]|\\.)*)"')
+    for path, text in texts.items():
+        current_font = {}
+        for line_number, line in enumerate(text.split('\n'), 1):
+            for font, charset in atlas.findall(line):
+                uses.setdefault(font, FontUse()).chars.update(unescape(charset))
+            for match in call.finditer(line):
+                target, method = match.group(1), match.group(2)
+                argument = first_argument(line[match.end():])
+                if method == 'setFont':
+                    font = re.fullmatch(r'&(\w+)', argument)
+                    current_font[target] = font.group(1) if font else None
+                    continue
+                font = current_font.get(target)
+                if font is None or argument == '':
+                    continue
+                use = uses.setdefault(font, FontUse())
+                text_value = text_of(argument, constants)
+                if text_value is None:
+                    use.runtime_text.append('%s:%d' % (path, line_number))
+                else:
+                    use.chars.update(text_value)
+    return uses
+
+
+def read_manifest():
+    entries = []
+    with open(MANIFEST) as f:
+        for line in f:
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            fields = line.split(None, 3)
+            if len(fields) < 3 or fields[2] not in ('full', 'subset', 'spans'):
+                sys.exit(MANIFEST + ': bad line: ' + line)
+            entries.append((fields[0], fields[1], fields[2], fields[3] if len(fields) > 3 else ''))
+    return entries
+
+
+def subset_header(header, name, chars):
+    """GFXfont header text of name in header with only chars, other glyphs are empty."""
+    with open(header) as f:
+        bitmap, glyphs, font_first, font_last, y_advance = parse_gfxfont(f.read(), name)
+    first, last = min(ord(c) for c in chars), max(ord(c) for c in chars)
+
+    subset_bitmap = []
+    subset_glyphs = []
+    for code in range(first, last + 1):
+        offset, w, h, x_advance, x_offset, y_offset = glyphs[code - font_first]
+        if chr(code) not in chars:
+            subset_glyphs.append((0, 0, 0, 0, 0, 0, code))
+            continue
+        size = (w * h + 7) // 8
+        subset_glyphs.append((len(subset_bitmap), w, h, x_advance, x_offset, y_offset, code))
+        subset_bitmap += bitmap[offset:offset + size]
+
+    out = []
+    out.append('// ' + name + ' subset generated by tools/subset_fonts.py from ' + header)
+    out.append('// characters: ' + ''.join(sorted(chars)))
+    out.append('')
+    out.append('const uint8_t ' + name + 'Bitmaps[] PROGMEM = {')
+    for i in range(0, len(subset_bitmap), 12):
+        out.append('  ' + ', '.join('0x%02X' % b for b in subset_bitmap[i:i + 12]) + ',')
+    out.append('  };')
+    out.append('')
+    out.append('const GFXglyph ' + name + 'Glyphs[] PROGMEM = {')
+    for offset, w, h, x_advance, x_offset, y_offset, code in subset_glyphs:
+        out.append('  { %5d, %3d, %3d, %3d, %4d, %4d },   // 0x%02X \'%s\'' % (offset, w, h, x_advance, x_offset, y_offset, code, chr(code)))
+    out.append('  };')
+    out.append('')
+    out.append('const GFXfont ' + name + ' PROGMEM = {')
+    out.append('  (uint8_t  *)' + name + 'Bitmaps,')
+    out.append('  (GFXglyph *)' + name + 'Glyphs,')
+    out.append('  0x%02X, 0x%02X, %d };' % (first, last, y_advance))
+    out.append('')
+    out.append('// Approx. %d bytes' % (len(subset_bitmap) + 7 * len(subset_glyphs) + 7))
+    out.append('')
+    return '\n'.join(out), len(subset_bitmap)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--check', action='store_true', help='do not write, fail if a generated header is out of date')
+    args = parser.parse_args()
+
+    uses = scan_sources()
+    entries = read_manifest()
+    errors = []
+
+    for font in sorted(set(uses) - {entry[0] for entry in entries}):
+        errors.append(font + ': drawn but not in ' + MANIFEST)
+
+    for font, header, mode, extra in entries:
+        use = uses.get(font, FontUse())
+        with open(header) as f:
+            _, glyphs, font_first, _, _ = parse_gfxfont(f.read(), font)
+        chars = use.chars | set(extra)
+        missing = sorted(c for c in chars if not font_first <= ord(c) < font_first + len(glyphs))
+        if missing:
+            errors.append(font + ': no glyph for ' + repr(''.join(missing)))
+            continue
+        if mode == 'full':
+            continue
+        if mode == 'subset' and use.runtime_text and not extra:
+            errors.append(font + ': runtime text drawn at ' + ', '.join(use.runtime_text) + ' needs extra characters')
+            continue
+        if not chars:
+            errors.append(font + ': nothing drawn, remove it from ' + MANIFEST)
+            continue
+
+        if mode == 'subset':
+            output = 'Fonts/' + font + '_subset.h'
+            text, size = subset_header(header, font, chars)
+            summary = '%d bitmap bytes' % size
+        else:
+            output = 'Fonts/' + font + '_spans.h'
+            text = span_font_header(header, font, ''.join(sorted(chars)))
+            summary = text.split('\n')[2][3:]
+        current = open(output).read() if os.path.exists(output) else None
+        if current == text:
+            print('%-26s %-7s %s, up to date' % (font, mode, summary))
+        elif args.check:
+            errors.append(output + ' is out of date, run tools/subset_fonts.py')
+        else:
+            with open(output, 'w') as f:
+                f.write(text)
+            print('%-26s %-7s %s, written to %s' % (font, mode, summary, output))
+
+    for error in errors:
+        print('error: ' + error, file=sys.stderr)
+    sys.exit(1 if errors else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -35,6 +35,15 @@ bool Touchscreen::IsTouched() {
   }
 }
 
+// XPT2046 library owns the touch interrupt and only sets a flag in it, so the core sleeps
+// in short slices and checks that flag, no SPI transfer until there is a touch
+bool Touchscreen::WaitForTouch(unsigned short max_wait_ms) {
+  unsigned long start_millis = millis();
+  while(!touchscreen_ptr_->tirqTouched() && millis() - start_millis < max_wait_ms)
+    delay(kWaitSliceMs);
+  return touchscreen_ptr_->tirqTouched();
+}
+
 TouchPixel* Touchscreen::GetTouchedPixel() {
   if(millis() - last_polled_millis_ <= kPollingGapMs) {
     // return last touch point
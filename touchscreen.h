@@ -34,6 +34,9 @@ private:
   // minimum time gap in milliseconds before polling touchscreen
   const unsigned short kPollingGapMs = 100;
 
+  // sleep slice while waiting for touch interrupt
+  const unsigned short kWaitSliceMs = 10;
+
   // store touchscreen calibration
   TouchCalibration touchscreen_calibration_;
 
@@ -51,6 +54,9 @@ public:
   // to know if touchscreen is touched
   bool IsTouched();
 
+  // sleep until touch interrupt fires, at most max_wait_ms, returns true if it fired
+  bool WaitForTouch(unsigned short max_wait_ms);
+
   // function to get x, y and isTouched flag
   TouchPixel* GetTouchedPixel();
 